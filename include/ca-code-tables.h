@@ -0,0 +1,814 @@
+#ifndef CA_CODE_TABLES_H
+#define CA_CODE_TABLES_H
+
+// Generated by tools/ca-code-tables-generator.c. Don't edit by hand!
+
+#include <stdint.h>
+
+#define CA_CODE_TABLE_COUNT (112)
+#define CA_CODE_TABLE_MAX_PRN (202)
+
+static const short caCodeTableRows[203] = {
+	-1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 
+	15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 
+	31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 
+	47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 
+	-1, -1, -1, -1, -1, -1, -1, -1, 63, 64, 65, 66, 67, 68, 69, 70, 
+	71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 
+	87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, -1, 
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 
+	-1, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 
+};
+
+static const uint64_t caCodeTables[112][16] = {
+	// GPS PRN 1
+	{
+		0xA88B57C8A7929C13ULL, 0x008553ECEDF9789AULL, 0xF406F33AF07B2257ULL, 0x8041A8AF63B4657CULL, 
+		0x86D2E5FF6381B8C0ULL, 0x261B0F771BB4E46AULL, 0x507E4A0747B4B609ULL, 0x7636AB638CCFAF9DULL, 
+		0x2975D505B9B34007ULL, 0xE71B5B50B4A291CEULL, 0xA4933ABE1169F84DULL, 0xA50A9C34EC7BE1FFULL, 
+		0x80F8C5F7E6E5BC7EULL, 0x7122C5B81B222D14ULL, 0x6CF596533F679334ULL, 0x04538724422B1EE5ULL, 
+	},
+	// GPS PRN 2
+	{
+		0x2FF4D3F6997C1C27ULL, 0xC4710E60C78D110DULL, 0x3B1F070F4B0B41E5ULL, 0xCB66627458F01D63ULL, 
+		0x90790550315247A0ULL, 0xC48554A82AD5DFFEULL, 0x783B2A9C0ECA4284ULL, 0xBEDC992B3AD11037ULL, 
+		0xBA40D62C3439E906ULL, 0x14B51107CDA5DA51ULL, 0x6575C6F7D7C49B97ULL, 0x67C5EDF783D74ACFULL, 
+		0x0860CD33C2D6847BULL, 0x05F30BD15CCBE6BFULL, 0x69E73796D3BE9979ULL, 0x098502D296F7D667ULL, 
+	},
+	// GPS PRN 3
+	{
+		0x210BDB8AE4A11C4FULL, 0x4D99B5789365C222ULL, 0xA52CEF643DEB8680ULL, 0x5D29F7C22E78ED5CULL, 
+		0xBD2EC40E94F5B960ULL, 0x01B9E3164817A8D6ULL, 0x28B1EBAA9C37AB9FULL, 0x2F08FDBA56EC6F63ULL, 
+		0x9C2AD07F2F2CBB05ULL, 0xF3E985A93FAB4D6EULL, 0xE6B83E645A9E5C22ULL, 0xE25B0E715C8E1CAEULL, 
+		0x1950DCBB8AB0F470ULL, 0xEC509703D31871E8ULL, 0x63C2741D0A0C8DE3ULL, 0x1228093F3F4E4763ULL, 
+	},
+	// GPS PRN 4
+	{
+		0x3CF5CB721F1B1C9FULL, 0x5E48C3483AB4647CULL, 0x994B3FB2D02A084BULL, 0x71B6DCAEC3690D23ULL, 
+		0xE78146B3DFBA44E1ULL, 0x8BC08C6A8D934686ULL, 0x89A469C7B9CC79A8ULL, 0x0CA034988E9691CBULL, 
+		0xD0FEDCD919061F02ULL, 0x3D50ACF4DBB66310ULL, 0xE123CF43402BD349ULL, 0xE966C97CE23CB06DULL, 
+		0x3B30FFAB1A7C1467ULL, 0x3F17AEA6CCBF5F46ULL, 0x7788F30AB968A4D6ULL, 0x25721EE46C3D656BULL, 
+	},
+	// GPS PRN 5
+	{
+		0x7D9F7578EA362369ULL, 0x806126F5C9A277C5ULL, 0x3BCF69BB64BDE703ULL, 0x6D387F8A4808E6D9ULL, 
+		0x1EB216814762EE71ULL, 0x24FA68CFFA03323FULL, 0x85BA060325A6AF95ULL, 0x508CC384B86C5B78ULL, 
+		0x68775C555B452C82ULL, 0xEA1DB0124FC8FFAAULL, 0xC172E55F1EE643EDULL, 0x49BBA1238F717CE5ULL, 
+		0x870B038AEB8B6066ULL, 0xA9300C4AADECFC0AULL, 0x89F03CAB14B327CBULL, 0x272B20B2B5E746ABULL, 
+	},
+	// GPS PRN 6
+	{
+		0x85DC9696023562D3ULL, 0xC5B9E4528F3B0FB2ULL, 0xA48C320C6286CB4CULL, 0x1195CC3E0F891A28ULL, 
+		0xA0B8E3AC7894EAC3ULL, 0xC1479BD9E9BA7355ULL, 0xD3B3B294CAEE71BCULL, 0xF3A848E55396F9FCULL, 
+		0x3845C48DF1D5300CULL, 0x0EB8C7823B710699ULL, 0xAEB67935C8DBECD7ULL, 0xBEA797D945C270FBULL, 
+		0x078741C9D80B3C4AULL, 0xB5D6983431564483ULL, 0xA3EC62668417F086ULL, 0x4F744DFF796F66FAULL, 
+	},
+	// GPS PRN 7
+	{
+		0x52918A70964BFE69ULL, 0xE5E8CE4ED1F69F16ULL, 0x04515A530FCB07C4ULL, 0xADAE301FFE7E6E29ULL, 
+		0x369F414019C7498FULL, 0x3F3F54784461F048ULL, 0xD1EA8CC21334527CULL, 0x531D17E029006607ULL, 
+		0x57513653085E39D0ULL, 0x5FFAEC86E13AF13DULL, 0xA0F128A78D6B192AULL, 0x423E3FC009AE25B3ULL, 
+		0xD01A339B63C30616ULL, 0x33D9AFD67F632F9DULL, 0x8DFA19E89F6A95DFULL, 0x13308DB9584EFF3AULL, 
+	},
+	// GPS PRN 8
+	{
+		0xDBC16886FACED8D3ULL, 0x0EAA3524BF92DE14ULL, 0xDBB055DCB46B0AC2ULL, 0x90B9531563640BC8ULL, 
+		0xF0E24C2EC5DFA53EULL, 0xF6CDE2B6957FF7BBULL, 0x7B12A716A7CB8A6EULL, 0xF48BE02C714E8302ULL, 
+		0x4609108157E31AA8ULL, 0x65767EAB66951BB7ULL, 0x6DB1E2C4EFC15958ULL, 0xA9ACAA1E487CC257ULL, 
+		0xA9A521EAC89BF0AAULL, 0x8005DF0D9449E3ADULL, 0xABF828E193A494AFULL, 0x274317E8A23C15D8ULL, 
+	},
+	// GPS PRN 9
+	{
+		0xC960AD6A23C495A7ULL, 0xD82FC3F0635A5C11ULL, 0x64724AC3C32B10CFULL, 0xEA9795005950C00BULL, 
+		0x7C1856F37DEE7C5CULL, 0x65288F2B3743F85CULL, 0x2EE2F0BFCE343A4BULL, 0xBBA60FB4C1D34909ULL, 
+		0x64B95D25E8995C59ULL, 0x106F5AF069CACEA3ULL, 0xF73076022A95D9BCULL, 0x7E8981A2CBD90D9EULL, 
+		0x5ADB05099E2A1DD3ULL, 0xE7BD3EBA421C7BCDULL, 0xE7FC4AF38A38964EULL, 0x4FA4234B56D9C01CULL, 
+	},
+	// GPS PRN 10
+	{
+		0x66E210216C39148BULL, 0xA140BF35E7B40C4BULL, 0x71F027E638F92745ULL, 0x425EB7D823AE68AAULL, 
+		0xA814F0C5574A7B7FULL, 0xDC01D2CF2A6D8610ULL, 0xB513D7A57BBB5185ULL, 0x8661020A737F8A0EULL, 
+		0x049A4DB524794B52ULL, 0x5756FFEFCEE46081ULL, 0xBDB761B14EBCEC6FULL, 0x249E5AF1B8FB058AULL, 
+		0xA5D37974432A75E4ULL, 0x0F0626EEAACF54C3ULL, 0xD41421856AFFF3C7ULL, 0x0031953DDE29FF82ULL, 
+	},
+	// GPS PRN 11
+	{
+		0xB3265C250E2B0D17ULL, 0x87FAD7D2D317F8AEULL, 0x30F2AEB6DA0F4BC0ULL, 0x4F585C9AD8C406CEULL, 
+		0xCDF52F2458C5C0DFULL, 0x30B0EFD849671B0AULL, 0xB2E011D876D58D9DULL, 0x5E73CBF8C5B15B10ULL, 
+		0xE19FE74D0FADFFADULL, 0x742E5879392838CFULL, 0x573D70E9686EB3D2ULL, 0x64EC607D2AD68225ULL, 
+		0x4237B4348949174EULL, 0xF9BACD7C3F111511ULL, 0x1824583A788E589FULL, 0x014126E1AEF214A8ULL, 
+	},
+	// GPS PRN 12
+	{
+		0x4FBFF43C4247585FULL, 0x5067A58068DFC2F2ULL, 0xB6FD9954943A20DEULL, 0x614E2714C3B96397ULL, 
+		0x91B1EF6279E4591FULL, 0x5B1661AB03585557ULL, 0xA2C884D659B345CFULL, 0x8E1D7FD77317BD54ULL, 
+		0xBF82195DF75645ADULL, 0xBF3D890F0981E969ULL, 0x28011739BE83725CULL, 0xE5C0FF56463B93C5ULL, 
+		0x126D1BB6340258B3ULL, 0xCE30B41343D491FFULL, 0xB0854DB815ABA34DULL, 0x06628E288C2A6E56ULL, 
+	},
+	// GPS PRN 13
+	{
+		0xE19D941F52D794BFULL, 0x65B4E2B9CDC065DCULL, 0xBEE9D3D3838944F7ULL, 0x09797D0318EA10B5ULL, 
+		0xBEBF106A0599841FULL, 0x3E9F89101B0CBD84ULL, 0x9D56B73E32C5A508ULL, 0x4E8B3042C56135A4ULL, 
+		0x97AF4E9CA9F3E253ULL, 0xA4F8B5B8B7E32B1EULL, 0x7C519DF888118FB5ULL, 0xE6512B32D757AEBAULL, 
+		0x2D4B71B067194DE1ULL, 0x7BD7E887ED269F68ULL, 0xD10680408626F98AULL, 0x0DE710CB0AF53700ULL, 
+	},
+	// GPS PRN 14
+	{
+		0xBDD9545973F60D7FULL, 0x0E126CCA87FF2B81ULL, 0xAEC146DDACEF8CA5ULL, 0xD917C92CAE4CF6F1ULL, 
+		0xE0A2EE7AFD623E1FULL, 0xF58C58662BA56C22ULL, 0xE26AD0EEE4286486ULL, 0xCFA7AF69A98C2444ULL, 
+		0xC7F5E11E14B8ADAEULL, 0x9372CCD7CB26AFF0ULL, 0xD4F0887AE5347467ULL, 0xE17283FBF58FD444ULL, 
+		0x5307A5BCC12F6745ULL, 0x101951AEB0C28246ULL, 0x12011BB1A13C4C05ULL, 0x1AEC2D0C074B85ACULL, 
+	},
+	// GPS PRN 15
+	{
+		0x0550D4D531B53EFFULL, 0xD95F702C1381B73BULL, 0x8E906CC1F2221C01ULL, 0x79CAA173C3013A79ULL, 
+		0x5C99125B0C954A1EULL, 0x63ABFA8A4AF6CF6EULL, 0x1C121F4F49F3E79BULL, 0xCDFE913F70560784ULL, 
+		0x6740BE1B6E2E3255ULL, 0xFC663E0932ADA62CULL, 0x85B2A37E3F7F83C3ULL, 0xEF35D269B03F21B9ULL, 
+		0xAF9E0DA58D43320DULL, 0xC78423FC0B0AB81AULL, 0x940E2C53EF09271BULL, 0x34FA56821C36E0F5ULL, 
+	},
+	// GPS PRN 16
+	{
+		0x7443D5CDB53359FFULL, 0x77C549E13B7C8E4EULL, 0xCE3238F94FB93D48ULL, 0x387071CD199AA369ULL, 
+		0x24EEEA18EF7BA21DULL, 0x4FE4BF52885189F7ULL, 0xE0E3800C1244E1A0ULL, 0xC94CED92C3E24005ULL, 
+		0x262A00119B030DA3ULL, 0x224FDBB4C1BBB595ULL, 0x2736F5778BE86C8BULL, 0xF3BB714D3B5ECA43ULL, 
+		0x56AD5D97159B989DULL, 0x68BEC7597C9ACCA3ULL, 0x981043977363F126ULL, 0x68D6A19E2ACC2A46ULL, 
+	},
+	// GPS PRN 17
+	{
+		0x59C47A273F2201D9ULL, 0x14A7E3A1494602DCULL, 0x1073EA1EAB747D82ULL, 0x49DB293BA57131FCULL, 
+		0xFF05C0D4DF021D0FULL, 0x46E87153F8E25587ULL, 0xB119F2E6F062E391ULL, 0xB27AAF019ED6339FULL, 
+		0x931D32311A47A5D2ULL, 0xE5920BB242CE14E8ULL, 0xA27878457B079C0CULL, 0x44D57D3B63C041F2ULL, 
+		0x31C5D294EC78A61BULL, 0x82E4B8B575FE35F8ULL, 0x7E3C64E5F1B68D33ULL, 0x01F97F0F969FE13DULL, 
+	},
+	// GPS PRN 18
+	{
+		0xCD6A8829A81D27B3ULL, 0xEC346EFB8EF3E580ULL, 0xF3F53547FD15FE4FULL, 0x5853615DD57AB462ULL, 
+		0x63D74F0748550C3FULL, 0x0563A8E1EC78BC24ULL, 0xBAF45B5F6166E9B4ULL, 0x364491EF1EE22832ULL, 
+		0xCE91184573D022ADULL, 0x11A7B0C2217CD01CULL, 0x68A3430103185315ULL, 0xA47A2FE89CA00AD5ULL, 
+		0x6A1AE3F5D7ECB0B0ULL, 0xE27FF1CB8173D766ULL, 0x4C74D2FB4E1CA576ULL, 0x02D0F2853F9E29D7ULL, 
+	},
+	// GPS PRN 19
+	{
+		0xE4376C3486636B67ULL, 0x1D13744E01982B39ULL, 0x34F88BF551D6F9D4ULL, 0x7B43F191356DBF5FULL, 
+		0x5A7250A066FB2E5FULL, 0x82741B85C54D6F63ULL, 0xAD2F082C436EFDFEULL, 0x3E38EC321E8A1F68ULL, 
+		0x75894CADA0FF2C52ULL, 0xF9CCC622E61959F4ULL, 0xFD153589F327CD26ULL, 0x65248A4F62609C9AULL, 
+		0xDDA48137A0C49DE7ULL, 0x234963366868125AULL, 0x28E5BEC63148F5FCULL, 0x0483E9906D9DB803ULL, 
+	},
+	// GPS PRN 20
+	{
+		0xB68CA40EDA9FF2CFULL, 0xFF5D41251F4FB64BULL, 0xBAE3F6900850F6E3ULL, 0x3D62D008F543A924ULL, 
+		0x29386FEE3BA76A9FULL, 0x8C5B7D4D9726C9EDULL, 0x8299AECA077ED56BULL, 0x2EC017881E5A71DCULL, 
+		0x03B9E57C06A131ACULL, 0x291A2BE368D24A25ULL, 0xD679D8981358F141ULL, 0xE799C1009FE1B005ULL, 
+		0xB2D844B34E94C748ULL, 0xA12446CDBA5F9823ULL, 0xE1C766BCCFE054E9ULL, 0x0825DFBAC99A9BABULL, 
+	},
+	// GPS PRN 21
+	{
+		0x13FB347A6366C19FULL, 0x3BC12BF322E08CAFULL, 0xA6D50C5ABB5CE88CULL, 0xB120933B751F85D3ULL, 
+		0xCFAC1172811FE31FULL, 0x9005B0DD33F184F1ULL, 0xDDF4E3068F5E8441ULL, 0x0F31E0FC1FFAACB4ULL, 
+		0xEFD8B6DF4A1D0A50ULL, 0x88B7F06075446D87ULL, 0x80A002BBD3A6898EULL, 0xE2E3579F64E3E93BULL, 
+		0x6C21CFBA92347217ULL, 0xA5FE0D3A1E308CD1ULL, 0x7382D64932B116C2ULL, 0x1169B3EF8194DCFAULL, 
+	},
+	// GPS PRN 22
+	{
+		0x591414931094A73FULL, 0xB2F9FE5F59BEF966ULL, 0x9EB8F9CFDD44D453ULL, 0xA9A4155C75A7DC3DULL, 
+		0x0284EC4BF46EF01EULL, 0xA8B82BFC7A5F1EC8ULL, 0x632E789F9F1E2615ULL, 0x4CD20E141CBB1664ULL, 
+		0x371A1199D3657DA8ULL, 0xCBEC47664E6822C2ULL, 0x2D13B6FC525A7811ULL, 0xE8167AA092E75B47ULL, 
+		0xD1D2D9A92B7518A9ULL, 0xAC4A9AD556EEA534ULL, 0x5709B7A2C8139294ULL, 0x23F16B4511885259ULL, 
+	},
+	// GPS PRN 23
+	{
+		0xC0BC0DDF7CC1EF31ULL, 0x2F8BACE49184A59AULL, 0x918F1B81E82FCA84ULL, 0xBFDF9B4708C285BBULL, 
+		0x4644AA6AD5F73030ULL, 0x0E3658B645114394ULL, 0x4BBB76B0F9D6747EULL, 0x226621A2BA5D5274ULL, 
+		0x2AE4016128DF7D78ULL, 0xD83D3156E7B9849CULL, 0x1174662ABF9BF6DAULL, 0xC48951CC7FF6BB38ULL, 
+		0x8B7D5B14603AE528ULL, 0x2633F5A9936A4B64ULL, 0xF61C35CFEDE840A3ULL, 0x0059A267C9F2ACF1ULL, 
+	},
+	// GPS PRN 24
+	{
+		0x7D4F1BCCC580858FULL, 0x263F3B0BD95A8C7FULL, 0xB5047A6A128D4ED2ULL, 0x8D4743ED98DE0B18ULL, 
+		0xE3333A1E6C0E0360ULL, 0xCAAA326078BE7970ULL, 0x578D8C7A4ADA6A11ULL, 0xAE2462913A017E83ULL, 
+		0xCC707FFD9267F4F8ULL, 0xC463FCC6436EC980ULL, 0x4E192BE637BBA7F0ULL, 0xE578A6B87E566650ULL, 
+		0x671C08B72C86DED4ULL, 0x879E2E2A8EFC6CC6ULL, 0xA0C5EFEC2D16386CULL, 0x052334F832F0F5CFULL, 
+	},
+	// GPS PRN 25
+	{
+		0x847C4BFE5D582F1FULL, 0x8905DFAEAECAF8C6ULL, 0xB91A15AE8EE798EFULL, 0xD16BB4F1AE24C1ABULL, 
+		0x5BBABA922E4D30E0ULL, 0x1DE72E86ECC0E5CAULL, 0x77DCA6661417FAB5ULL, 0x0EF90ACE574CB20BULL, 
+		0x704B83DC639080F9ULL, 0x52445E2A223D6ACCULL, 0xB061E4479A6024EDULL, 0xE72198EEA78C4590ULL, 
+		0xC7A957B25610412FULL, 0xE88ADCF47777651AULL, 0xF187C4E8F75DCFC8ULL, 0x0B64656A77400032ULL, 
+	},
+	// GPS PRN 26
+	{
+		0x761AEB9B6CE97A3FULL, 0xD77016E441EA11B5ULL, 0xA126CA27B6323494ULL, 0x69325AC9C3D154CDULL, 
+		0x2AA9BB8AAACB57E0ULL, 0xB37D174BC43DDCBFULL, 0x377EF25EA98CDBFCULL, 0x4F43DA708DD72B1BULL, 
+		0x083C7B9F807E68FAULL, 0x7E0B1BF2E09A2C55ULL, 0x4C907B04C1D722D6ULL, 0xE393E44314380211ULL, 
+		0x86C3E9B8A33D7ED9ULL, 0x36A33949846176A3ULL, 0x530392E143CA2080ULL, 0x17EAC64EFC21EBC8ULL, 
+	},
+	// GPS PRN 27
+	{
+		0x92D7AB510F8BD07FULL, 0x6B9B84719FABC352ULL, 0x915F7535C7996C62ULL, 0x198186B9183A7E01ULL, 
+		0xC88FB9BBA3C799E1ULL, 0xEE4964D195C7AE55ULL, 0xB63A5A2FD2BA996FULL, 0xCC367B0D38E0193BULL, 
+		0xF8D38B1847A3B8FCULL, 0x2695904365D4A167ULL, 0xB573458276B92EA0ULL, 0xEAF71D1873508D12ULL, 
+		0x041695AD49670135ULL, 0x8AF0F232624D51D1ULL, 0x160B3EF22AE5FE11ULL, 0x2EF78007EAE23C3DULL, 
+	},
+	// GPS PRN 28
+	{
+		0x5B4D2AC5C94E84FFULL, 0x124CA15A2328669DULL, 0xF1AC0B1124CFDD8FULL, 0xF8E63E58AFEC2B99ULL, 
+		0x0CC3BDD9B1DE05E3ULL, 0x542183E536334B80ULL, 0xB4B30ACD24D61C49ULL, 0xCADD39F6528E7D7AULL, 
+		0x190C6A17C81818F1ULL, 0x97A887206F49BB02ULL, 0x46B5388F1865364CULL, 0xF83EEFAEBD819315ULL, 
+		0x01BC6D869DD3FEEDULL, 0xF25764C5AE151F34ULL, 0x9C1A66D4F8BA4332ULL, 0x5CCD0C95C76593D7ULL, 
+	},
+	// GPS PRN 29
+	{
+		0x0ED54A36B76A67A9ULL, 0x8E4E403D9BC9D14BULL, 0x1479CF5D20ADCF96ULL, 0x7DC0843048D8886DULL, 
+		0x6882BF50E13CF38FULL, 0xF42C850E74C821EEULL, 0xAED6EB12C5D993F2ULL, 0xD23188CB45ED77E7ULL, 
+		0x070B99D1B515762DULL, 0x687095E99DFF75D3ULL, 0x08503D25E04EE2F8ULL, 0x451D97092B765F4DULL, 
+		0xAE56E797C5F52CB2ULL, 0x581716FF228732B3ULL, 0x4EFD8219B8702050ULL, 0x043BB07E55F04D96ULL, 
+	},
+	// GPS PRN 30
+	{
+		0x6348E80AB88DEB53ULL, 0xD9E729C22BEC42AEULL, 0xFBE17FC0EAA69A66ULL, 0x30643B4A0E29C740ULL, 
+		0x4CD9B00F3428D13FULL, 0x60EA405AF42C54F7ULL, 0x856A68B70A100973ULL, 0xF6D2DE7AA894A0C2ULL, 
+		0xE6BC4F842D758553ULL, 0x0A628C759F1E126BULL, 0x3CF3C9C0358AAEFCULL, 0xA7EBFB8C0DCC37AAULL, 
+		0x553C89F384F7A5E2ULL, 0x5798AD5F2F81D9F1ULL, 0x2DF71F03DD91FFB1ULL, 0x09556C66B9417081ULL, 
+	},
+	// GPS PRN 31
+	{
+		0xB873AC72A742F2A7ULL, 0x76B5FA3D4BA76564ULL, 0x24D01EFB7EB03186ULL, 0xAB2D45BE83CB591BULL, 
+		0x046FAEB09E00945FULL, 0x4967CAF3F5E4BEC5ULL, 0xD2136FFC95833C70ULL, 0xBF14731972670E88ULL, 
+		0x25D3E32F1DB463AFULL, 0xCE46BF4D9ADCDD1AULL, 0x55B4200B9E0236F4ULL, 0x6207228640B8E664ULL, 
+		0xA3E8553B06F2B743ULL, 0x4887DA1F358C0F74ULL, 0xEBE2253716524073ULL, 0x1388D45760230AAFULL, 
+	},
+	// GPS PRN 32
+	{
+		0x0E05248298DCC14FULL, 0x28105DC38B312AF1ULL, 0x9AB2DC8C569D6647ULL, 0x9DBFB857980E65ACULL, 
+		0x950393CFCA501E9EULL, 0x1A7CDFA1F6756AA1ULL, 0x7CE1616BAAA55676ULL, 0x2C9929DEC780521CULL, 
+		0xA30CBA797C37AE57ULL, 0x460ED93D915943F9ULL, 0x873BF39CC91306E5ULL, 0xE9DE9092DA5145F8ULL, 
+		0x4E41ECAA02F89200ULL, 0x76B9349F0197A27FULL, 0x67C8515E81D53FF7ULL, 0x2633A434D2E7FEF2ULL, 
+	},
+	// GPS PRN 33
+	{
+		0x62E83562E7E0A69FULL, 0x955B123E0A1DB5DAULL, 0xE677586206C7C9C5ULL, 0xF09A4385AF841CC3ULL, 
+		0xB7DBE93162F10B1CULL, 0xBC4AF505F156C268ULL, 0x21057C45D4E9827AULL, 0x0B839C51AC4EEB35ULL, 
+		0xAEB208D5BF3035A6ULL, 0x569E15DD86527E3EULL, 0x222454B2673166C6ULL, 0xFE6DF4BBEF8202C1ULL, 
+		0x95129F880AECD887ULL, 0x0AC4E99F69A0F868ULL, 0x7F9CB98DAEDBC0FFULL, 0x4D4544F3B76E1649ULL, 
+	},
+	// GPS PRN 34
+	{
+		0x5018DA9260277B4FULL, 0xE3038CB5BB98FB57ULL, 0xE58EBB5C8070A7C9ULL, 0x1C93277CF4E3744CULL, 
+		0xC5593C4D771B5163ULL, 0x2DF6A6CE8AB0EE4FULL, 0xD44074E9C780ADA4ULL, 0x2BBA8117E55828E2ULL, 
+		0xDD406E75DA0184F3ULL, 0x2DC06014CCBD5ED7ULL, 0x443C686DEE09B36AULL, 0xFED5AD55D7EFF754ULL, 
+		0xE0638C8912685EE0ULL, 0x436A73A6A4880551ULL, 0x6FDC1BD996665BDEULL, 0x4E04FE2309B48DD0ULL, 
+	},
+	// GPS PRN 35
+	{
+		0xC516F5F4A87510E9ULL, 0x572C3A135DDCEB7FULL, 0x1B9E43A73A7077A7ULL, 0xCDE517D525452A51ULL, 
+		0xA289EAA0B6959A70ULL, 0xB2DDCA239B509173ULL, 0x7BC2C9A2887D2C88ULL, 0x52D5FDD261B678B8ULL, 
+		0xC8C2035021D3B379ULL, 0x850942CCB643F676ULL, 0x9030CE5BC4ADB449ULL, 0x47FCF0B1CAC18918ULL, 
+		0x7B92AB93A7E7352EULL, 0x7EAD7E181624C656ULL, 0x0FFF0B495A864CD5ULL, 0x093D5B3CAE9A23F2ULL, 
+	},
+	// GPS PRN 36
+	{
+		0xF4CF978E86B305D3ULL, 0x6B23DD9FA7C636C7ULL, 0xE42E6634DF1DEA05ULL, 0x502F1C80D5128338ULL, 
+		0xD8CF1BEF9B7A02C0ULL, 0xED08DE012B1D35CCULL, 0x2F422DD791597787ULL, 0xF71A3448E022BE7DULL, 
+		0x792F7A8704F80FFAULL, 0xD091223FC8671520ULL, 0x0C322F3C7C4C039FULL, 0xA22934FDCEA39B01ULL, 
+		0xFEB411FB40D396DAULL, 0x1AEC7C9146C6303AULL, 0xAFF20DA2187D26BBULL, 0x1358BAE34F95AC49ULL, 
+	},
+	// GPS PRN 37
+	{
+		0x5018DA9260277B4FULL, 0xE3038CB5BB98FB57ULL, 0xE58EBB5C8070A7C9ULL, 0x1C93277CF4E3744CULL, 
+		0xC5593C4D771B5163ULL, 0x2DF6A6CE8AB0EE4FULL, 0xD44074E9C780ADA4ULL, 0x2BBA8117E55828E2ULL, 
+		0xDD406E75DA0184F3ULL, 0x2DC06014CCBD5ED7ULL, 0x443C686DEE09B36AULL, 0xFED5AD55D7EFF754ULL, 
+		0xE0638C8912685EE0ULL, 0x436A73A6A4880551ULL, 0x6FDC1BD996665BDEULL, 0x4E04FE2309B48DD0ULL, 
+	},
+	// GPS PRN 38
+	{
+		0x2807158B9412C03FULL, 0x1C63C7927143C013ULL, 0xDE1AADF760DFF51AULL, 0xE81EC5E2AF3C452DULL, 
+		0x7AF314081780181DULL, 0x84F76E24B8F85851ULL, 0x9FDFE7DCC4A9202EULL, 0x486072B9AF0F51E5ULL, 
+		0x7670AF932648425EULL, 0x15C5A2DBBD7E317BULL, 0x8F97E0F5E6CD9759ULL, 0xF498D9841986B0BDULL, 
+		0x28E1899BB3ADB239ULL, 0x03707E70217ED18DULL, 0x5B17D866547944A9ULL, 0x7FDD9C59277298EAULL, 
+	},
+	// GPS PRN 39
+	{
+		0xB7FC17D2AA4419E5ULL, 0x15BF67272E46BA85ULL, 0x29BEC2E392010C91ULL, 0x1DE394A084389F66ULL, 
+		0x2FBB1A4F46125DADULL, 0xBEAB92BD10E1143DULL, 0xF4C13041B6FB9BE6ULL, 0x2D39F4B698ED1FD0ULL, 
+		0xEFB081855DC65923ULL, 0x5B98FE9F7D38105AULL, 0x47C58B5368BEDD66ULL, 0x12DCC9AC8C889FDBULL, 
+		0x92E159F50782049FULL, 0xD2D6206DDF6E2976ULL, 0x9A991375850F7400ULL, 0x6E3DE36540A24E07ULL, 
+	},
+	// GPS PRN 40
+	{
+		0x7C87F1FE8D369B30ULL, 0xB9AC0E08F0D706D6ULL, 0x6FF7D42045F44999ULL, 0xBD86A511D118A67BULL, 
+		0xE6F1F56FAF61AFCBULL, 0x6122AA68BC9A4A48ULL, 0x1AF95DB4239D83DAULL, 0x2C217030FFEDA789ULL, 
+		0xD67DA97864B32830ULL, 0x0FA043045C71BEC0ULL, 0x977B51C8F1AE9DC4ULL, 0xEA9F2A42648BDE61ULL, 
+		0xD7399B52411B7CE8ULL, 0x4D957BDAD9550539ULL, 0xE634A0C1C28E88F1ULL, 0x503716487F544AB5ULL, 
+	},
+	// GPS PRN 41
+	{
+		0x755B514BD233E1A6ULL, 0x4E08611C0209FF5DULL, 0x9A0A85626EF093D2ULL, 0xE8CEAB56808AE3CBULL, 
+		0xDCAD09F60778E3A7ULL, 0x0A3C7DF5CEC8F180ULL, 0x7FA0DBBB147FCDEFULL, 0xB5E15E268463BCF4ULL, 
+		0x9820F53CA4F50911ULL, 0xC7F228A2D202F4FFULL, 0x713F41E064A0B2A2ULL, 0x509FFA2CD0A468C7ULL, 
+		0x069FC54FBF0B8413ULL, 0x8C1BB0C908233590ULL, 0xF7D4DFFDA55E5E1CULL, 0x1FCA9764E07F2658ULL, 
+	},
+	// GPS PRN 42
+	{
+		0xECF34807BE66A9A8ULL, 0xD37A33A7CA33A3A1ULL, 0x953D672C5B9B8D05ULL, 0xFEB5254DFDEFBA4DULL, 
+		0x986D4FD726E12389ULL, 0xACB20EBFF186ACDCULL, 0x5735D59472B79F84ULL, 0xDB5571902285F8E4ULL, 
+		0x85DEE5C45F4F09C1ULL, 0xD4235E927BD352A1ULL, 0x4D58913689613C69ULL, 0x7C00D1403DB588B8ULL, 
+		0x5C3047F2F4447992ULL, 0x0662DFB5CDA7DBC0ULL, 0x56C15D9080A58C2BULL, 0x3C625E463805D8F0ULL, 
+	},
+	// GPS PRN 43
+	{
+		0x320AC30E62C61CF7ULL, 0xD7A078506E5CB753ULL, 0x0778D7D9A6CACF2EULL, 0xE7F94918B5E1FD1CULL, 
+		0xCAD687ED7A1DBA21ULL, 0x4EFC3BD4EF5131AEULL, 0xD92EA8F12B3190B3ULL, 0x9D745009E2ABEE9FULL, 
+		0xF694DA8A02134D01ULL, 0xDA0C385A29B8F42FULL, 0x62EE37D0CD7114FCULL, 0x6CF82AFA3D65E60CULL, 
+		0x2A00EE23521A646CULL, 0xD6B43274436CC811ULL, 0x7DADB08160DAB04CULL, 0x3EDF1509C584F46FULL, 
+	},
+	// GPS PRN 44
+	{
+		0x98F2E8DAD639C4E5ULL, 0x70368F9C36125256ULL, 0x1620F10BF977EC56ULL, 0xDD75DB35324E1796ULL, 
+		0x07964D8E18B7FA53ULL, 0xA56EAE0AAE83D64AULL, 0xA091BA808069660FULL, 0x2EA820D2098122AFULL, 
+		0xD096EB830EDD4C71ULL, 0xEE7FA20BD3CA1ECDULL, 0x264646ABFB3387A1ULL, 0x1959574F0A57C68DULL, 
+		0xC5F069E48FCA62EFULL, 0x483F83F10DE1FAE1ULL, 0x9E9336360ED6C614ULL, 0x5A264E6EAD0BF796ULL, 
+	},
+	// GPS PRN 45
+	{
+		0xDDFA44C9BF161A74ULL, 0x492BC9D520D185A3ULL, 0xE446516EC8C6B976ULL, 0x8300127FDD6EFEE5ULL, 
+		0x1FAA920720625628ULL, 0x1D374032C376432CULL, 0xD182BB9804EF010FULL, 0x8032191F217C1BDAULL, 
+		0x9034BFBBB3466D38ULL, 0xAFC572B5095187DDULL, 0x5E31BEE818DD6FA2ULL, 0x35161297C8F08014ULL, 
+		0x3901F6A7D47D64D4ULL, 0x4C8DFF5CBE55BD60ULL, 0xDFF9883CFBFBF9E2ULL, 0x040FABD35E1DE42FULL, 
+	},
+	// GPS PRN 46
+	{
+		0xB23ED8A3692BB54EULL, 0xBE37FF2FEA6289BDULL, 0x64CA132DFB46E55AULL, 0x9FE6860141D4466CULL, 
+		0x35B6CCCAB0C68165ULL, 0x75682D7F0FFE637DULL, 0x2DA34A6F70EEA1D2ULL, 0x22DE784C8230A7E1ULL, 
+		0x5F951260305BFB1FULL, 0x9193AB6F2A9179A5ULL, 0x0134C47E87266DFBULL, 0xC7C8EB1CC12C20A1ULL, 
+		0x12052CEC23D90BC0ULL, 0x1D1FBAEC4BA8EC22ULL, 0x77E0C450AEB3F7A5ULL, 0x765D101B644118B6ULL, 
+	},
+	// GPS PRN 47
+	{
+		0x4128CB1A28410B44ULL, 0x0AA01067344B6C00ULL, 0xEFABF8D759C2B353ULL, 0x073E2C915D5AE548ULL, 
+		0x4226B87349F5D157ULL, 0xE902FB42A0C487D8ULL, 0x1B5980DC7CF0CE16ULL, 0x609D4BCCDE1C50FDULL, 
+		0xCBEB8EDA88D27B93ULL, 0xCF5E3BCBFDDC6543ULL, 0x6C7908F6A77747E7ULL, 0x363F9F1D61F148FEULL, 
+		0x73568FA09FE2F7E1ULL, 0xB0C439F1DD8F4ECEULL, 0xAE3AE79050CB3804ULL, 0x0CCB8FE0661826E0ULL, 
+	},
+	// GPS PRN 48
+	{
+		0xEFDAC58D17676142ULL, 0x992D4AA081AC3094ULL, 0x6974A18138417EABULL, 0x8F764AE156DF7BABULL, 
+		0x90A96BE41EE4E146ULL, 0x62DB49563A2D2444ULL, 0xF6F0394D78FAEB55ULL, 0x5EA3A54CEA07FDF6ULL, 
+		0x47C1FAB31F550417ULL, 0xFAE54BA84F18911EULL, 0xB7424C8EB8B85E13ULL, 0x996D4CE201BA6F34ULL, 
+		0xAC67EE9B0BF45C01ULL, 0x2B8D4705506DD095ULL, 0xE68CF92FFAE37D64ULL, 0x2546054967D0CCD2ULL, 
+	},
+	// GPS PRN 49
+	{
+		0x0BC7EBF35BB36DE4ULL, 0x8398C5CB4F1519C9ULL, 0xD7C60D423FDA8F8CULL, 0x1FBAAAF65DE2BCA6ULL, 
+		0x8F0E454A3C84C256ULL, 0xD1BF6063E96A1DE1ULL, 0xA5831B456CB06C42ULL, 0x237EA524DD5DEA2DULL, 
+		0x1329299C11AA0C6BULL, 0x8C058CCDC6F02A06ULL, 0xC1CABCB1268BB678ULL, 0x3CCAB22297F5FA82ULL, 
+		0xCEA599B326A39D5FULL, 0xB970AE1E9551672BULL, 0x8AB1867BAA69BC52ULL, 0x3E53574AF604A843ULL, 
+	},
+	// GPS PRN 50
+	{
+		0xAE601533CDFCF852ULL, 0xE15AB2E36242D897ULL, 0x453BE459FAE63832ULL, 0x7387D5A20D687D90ULL, 
+		0x941B1749AD50A6C7ULL, 0x23B1F75CCF001BB2ULL, 0x28D9DCF08BECF8ECULL, 0xFC27F3455E9012BEULL, 
+		0x5B4F59979434EFEDULL, 0x03D61B9AD7C03B8EULL, 0x1878A82BCF282AAAULL, 0x957323269DD0B909ULL, 
+		0xF04B19873D0E96B2ULL, 0x9304C789122EE315ULL, 0x31C1E5C96E9DE1DEULL, 0x05172F55391D5C76ULL, 
+	},
+	// GPS PRN 51
+	{
+		0x53890EF6F14B4630ULL, 0xDC25E6B3E883EE05ULL, 0x5069E7C82E82A95EULL, 0x7D10EA84676E2E8BULL, 
+		0xCEDCA2AEF1C40835ULL, 0x7AE796DF02F8883FULL, 0x4EA9D775150F7E33ULL, 0x2FB0A4546E819AF6ULL, 
+		0xE95BC37E37A83D62ULL, 0xBA471F90F283B057ULL, 0xF6F89C306223C703ULL, 0xE11AB4A1E2548737ULL, 
+		0x8028AB43C9531A98ULL, 0xD77CD8460BDAD6AEULL, 0xE23E858249573AE5ULL, 0x642CBB4392FDF324ULL, 
+	},
+	// GPS PRN 52
+	{
+		0x96B5B94893893118ULL, 0x8CAF27857A7E071EULL, 0xC1BD835942BFD60AULL, 0x5B7AECD77C7B7C88ULL, 
+		0x2980360003CA9F0AULL, 0xF92A6E4C8FA24F8AULL, 0xCB3734F3CA562852ULL, 0x3E80B5DC26E7EAFDULL, 
+		0x00F85FACB87BAA35ULL, 0xB0625C1B2B31A4CDULL, 0xED5597DDCB9A5607ULL, 0x6665309FDCBA0703ULL, 
+		0x44DCF6CFE327730FULL, 0x18652C73B0AAB51CULL, 0xA9194F59721342FAULL, 0x72875BECC02E0C44ULL, 
+	},
+	// GPS PRN 53
+	{
+		0xB96B28F4C0424AFEULL, 0x4F78D2C072D21477ULL, 0x70E8A3605FF99F1CULL, 0x7B939F251ADB19B9ULL, 
+		0xFC2C4D5E7603D5E5ULL, 0x0CBF0854B37DC6B2ULL, 0x4D50344B93B8103FULL, 0xC3B9C0AD35E6F279ULL, 
+		0x9BD916022242671DULL, 0x2BFB4C5B89659C70ULL, 0x03BD949C714AE8DDULL, 0xC123A9E7AB4244E0ULL, 
+		0xF3DACDE3AC62ABCDULL, 0xAC22AD8F4135F647ULL, 0x8426B95DC06FEF49ULL, 0x6494E2ADAA9006B1ULL, 
+	},
+	// GPS PRN 54
+	{
+		0xBB3216A21998693EULL, 0xEFCD8DC508448B8CULL, 0x1FFC51BEA67296C0ULL, 0x2AD1B421C090EE1DULL, 
+		0xF26B1CCC33B32018ULL, 0xF026A04DFF1193FAULL, 0x9ACD461928702A63ULL, 0x45B6F74F7BD39967ULL, 
+		0xB5CF6D8C393F0244ULL, 0x77BF8C1DA84405B0ULL, 0x681B1AEF3B75A680ULL, 0xD10B3CE984248CB2ULL, 
+		0x23B479CC1AC44D89ULL, 0xF23F539FB9CE4C47ULL, 0x4F35682BF0C63EEFULL, 0x1BA8857D7C7DC73FULL, 
+	},
+	// GPS PRN 55
+	{
+		0x33C2293C2A700248ULL, 0x48334D5347D13DFAULL, 0xDD8B7993F1B3C865ULL, 0xD738AFE4FC27507FULL, 
+		0xCF14489CB972168AULL, 0xE574A3DC2B750296ULL, 0x945A793F42767978ULL, 0x1F7142A827473795ULL, 
+		0xEC990C0FF4C791C9ULL, 0x11CF879836A7836FULL, 0xBB8C4DFE0B642EC8ULL, 0x631FA60027B85E3DULL, 
+		0x9A257DC63F87C650ULL, 0x1CBF678414C5A1EEULL, 0x3B5CFFAC8F4200D1ULL, 0x6BCB37B988204B15ULL, 
+	},
+	// GPS PRN 56
+	{
+		0xF29C8C9BD4B09407ULL, 0xFF8D2F9130F910ADULL, 0x1CBDEB6E18A80D59ULL, 0xB3A9C3D9837300F5ULL, 
+		0xC9475389EB71875EULL, 0x71DA51D2BC4A24FCULL, 0x6CC9F46585C39E24ULL, 0xFCF79DF17126B458ULL, 
+		0xFD11446984CC1457ULL, 0x8D1D084BA1F0925FULL, 0xF807944C1FFEC76BULL, 0x68F20FB9B6BC5418ULL, 
+		0x1E1B4328BFB3DDFDULL, 0x41334DF07D522691ULL, 0xCF6944DCECF0C425ULL, 0x21100CFDF03F840CULL, 
+	},
+	// GPS PRN 57
+	{
+		0x6EF65AA67B8A70A2ULL, 0xC977E5223CE77F69ULL, 0x5EFED8EE4484FA45ULL, 0x27D75F633BFA8079ULL, 
+		0x978AC32D3C3C9BB8ULL, 0x1C979D5A9C1B0EE0ULL, 0x9D3E8064251EF67BULL, 0x9DA43EBDCD1D4879ULL, 
+		0x50CAC77412EBB6BBULL, 0x54C72B8B5F885DFEULL, 0x82910BB71DA7F93DULL, 0x9179066516090B1DULL, 
+		0xC450B48CD0A72F23ULL, 0x0483B80D2C100D95ULL, 0x83051194E2B795B7ULL, 0x1AD836A10CA62C15ULL, 
+	},
+	// GPS PRN 58
+	{
+		0xD5EE0E4EA8A57E5DULL, 0x211C93C2FB82F681ULL, 0xCB48AE66B4BB6476ULL, 0xE689FAC4C53A1636ULL, 
+		0x2034A1EF4B14B6EFULL, 0xDDA10FA77500CBDCULL, 0xF9AFEC595A4AA6F1ULL, 0x9BF725A89F1ED9ADULL, 
+		0xC464357A85D490D1ULL, 0xAC54A6D1983DBAA2ULL, 0x6117D4EE4BC67AF0ULL, 0x80F14E0366028E83ULL, 
+		0x58823B5F47F03E13ULL, 0x470861BF388AE436ULL, 0x88E8B82D73B39F92ULL, 0x1EE6084F8C9237B8ULL, 
+	},
+	// GPS PRN 59
+	{
+		0x7B1C00D99783145BULL, 0xB291C9054E65AA15ULL, 0x4D97F730D538A98EULL, 0x6EC19CB4CEBF88D5ULL, 
+		0xF2BB72781C0586FEULL, 0x5678BDB3EFE96840ULL, 0x140655C85E4083B2ULL, 0xA5C9CB28AB0574A6ULL, 
+		0x484E41131253EF55ULL, 0x99EFD6B22AF94EFFULL, 0xBA2C909654096304ULL, 0x2FA39DFC0649A949ULL, 
+		0x87B35A64D3E695F3ULL, 0xDC411F4BB5687A6DULL, 0xC05EA692D99BDAF2ULL, 0x376B82E68D5ADD8AULL, 
+	},
+	// GPS PRN 60
+	{
+		0x61C1B8E84EE16E75ULL, 0xDF0C6B39418226EFULL, 0x1A3E9ECF651D3A6BULL, 0x81592C2904B4DD25ULL, 
+		0xBF1FCD025AF4C9D3ULL, 0x7223B2EC3AFD4AF0ULL, 0x80C0909CDEA4F6ABULL, 0x8E75488D64CCEE27ULL, 
+		0x6CAD17A2FF2A3870ULL, 0x785800E7B299BD81ULL, 0xD83E890A56E804BCULL, 0x1B006919D38DE54DULL, 
+		0x654536E1F55CFD14ULL, 0x272B712FF46AF33DULL, 0xCFD11D32D49D31B0ULL, 0x54611FFCE8BB026BULL, 
+	},
+	// GPS PRN 61
+	{
+		0xF696A9D85F692613ULL, 0xCB96829ADD50A93CULL, 0x8B3A94EA2696E3D9ULL, 0x016D37840F59749CULL, 
+		0xD6884A7DDECAF73DULL, 0x1191761867716084ULL, 0xF8DF5F852A914DDBULL, 0x711503AAAE17D563ULL, 
+		0x573901091F856AA3ULL, 0x8CD5E279E9468CE0ULL, 0x6794A14F36734DC2ULL, 0xB201A1F3E1C55353ULL, 
+		0x2EDAA5D4F675709EULL, 0x44F18281BE3D8A3AULL, 0x64E1DCD428D4F71DULL, 0x6C64DD3399786DC7ULL, 
+	},
+	// GPS PRN 62
+	{
+		0xDD2A2A7D90A0BC92ULL, 0xEF75D42B30297E19ULL, 0x6A8D42BFBEF610A7ULL, 0x637F2E180DB81324ULL, 
+		0xE22BBE980B0EBB39ULL, 0xF3671A9D41CB0863ULL, 0x03B531E16B93C48BULL, 0x7E9AB80AA3113E21ULL, 
+		0x34339C137A64B542ULL, 0x81BB3E6105F7B1F7ULL, 0xD15A705131808BBFULL, 0x99D5150C39D79AA1ULL, 
+		0xD916FD9A1370DA66ULL, 0x6223DD3C9D452DACULL, 0xF6CC5B7BC25EE645ULL, 0x2607BF99D90A574BULL, 
+	},
+	// GPS PRN 63
+	{
+		0xF6FE9E8248B27560ULL, 0x18B98C65D52CD4E1ULL, 0x4C5F1D029D8EB731ULL, 0xF152A9B7E732027CULL, 
+		0x2848DC324B7C81B5ULL, 0x66B95B4FA62FC523ULL, 0x11C49AB99D2F2F19ULL, 0x0E4153206F21479EULL, 
+		0x053A90DD7B14069EULL, 0x1BEAC413EF1597F5ULL, 0xA0214613A2DDBFCCULL, 0xE460223E1956DE09ULL, 
+		0x5ED1204A15F3AFC7ULL, 0xD3A693B1AFB5C25CULL, 0x707B3577B40678CEULL, 0x7D60D716DAF3B475ULL, 
+	},
+	// SBAS PRN 120
+	{
+		0x19B640ABAD0F8676ULL, 0xF3432EE183256076ULL, 0xE6CF018C3EAA3C50ULL, 0x85EB5084B7009AA4ULL, 
+		0xFE757308AFD9F625ULL, 0xAC0A5751C9EB5949ULL, 0x2244C6956A3319E3ULL, 0x92FBEBA9EFAD05DDULL, 
+		0x959E479067F292E0ULL, 0xD762E442C509C938ULL, 0xD420E6CECA82D281ULL, 0x472C9E05E5772FFEULL, 
+		0xDDCCB66DB71FCE94ULL, 0xF0666DC960146F87ULL, 0xEF80372E8A50A114ULL, 0x74BC77A385F6CEE3ULL, 
+	},
+	// SBAS PRN 121
+	{
+		0x926FF2BF37E625EAULL, 0x1EEA9770872F4535ULL, 0xD8F1EF0C0AB1915BULL, 0x09C124ED2087E520ULL, 
+		0xCBCE036B1D1D0278ULL, 0x77311329D62440BDULL, 0x8D16156A0A783E29ULL, 0x4DCA8A927BBBAE3DULL, 
+		0x0ED73964EA100CBBULL, 0x9FD4FAFD6F218C58ULL, 0xFDAD6C67CB4A38B3ULL, 0x1055994E7AE41AFDULL, 
+		0x940A1B0E6DEC60DEULL, 0x3309C16250D5897BULL, 0x2BA404168F926E65ULL, 0x1DFB9E682E7E56EBULL, 
+	},
+	// SBAS PRN 122
+	{
+		0x15A82F6F3165504BULL, 0xAF6FD9FDB5DFAAC5ULL, 0x5E4681007CE90FD0ULL, 0x52A64C62237E061EULL, 
+		0xDE245914F1146681ULL, 0x0CD73F0EA4A695C1ULL, 0x9E7F3AB49BC46DE2ULL, 0x04DC49458EFEA691ULL, 
+		0x6BE68831CA2911FDULL, 0xD53BDA141CD3EAF8ULL, 0x7495B9CBB0144D7AULL, 0x28386CDB1CFC2622ULL, 
+		0x8C8E9D696D543930ULL, 0xFE213C5B25A49A7AULL, 0x13199F37C63CF45CULL, 0x232105F13E3EF4BFULL, 
+	},
+	// SBAS PRN 123
+	{
+		0x564BC1873224EA9BULL, 0x77AD7EBB2CA7DD3DULL, 0x1D1D360647C54095ULL, 0xFF15F825A282F781ULL, 
+		0xD4D1742B0710D4FDULL, 0xB124291D1DE7FF7FULL, 0x97CBAD5BD31A4407ULL, 0x205728AE745C22C7ULL, 
+		0x597E509B5A359F5EULL, 0x704C4A60A52AD9A8ULL, 0xB009D31D8DBB779EULL, 0x340E9611AFF0384DULL, 
+		0x00CCDE5AED0815C7ULL, 0x18B542C79F1C13FAULL, 0x0F4752A762EBB940ULL, 0x7C4C483DB61EA595ULL, 
+	},
+	// SBAS PRN 124
+	{
+		0x64D3192DA2386438ULL, 0xD2DAEECF955EEE6DULL, 0xD9815CD07A6A7A71ULL, 0xE32302EF118EE9EEULL, 
+		0x58933718874CF80AULL, 0x57B05781A75F76FFULL, 0x8B9560CB77CD091BULL, 0x7F3A6562FC7C73EDULL, 
+		0x788FA7EF5B954236ULL, 0x9C2D19C3E996E254ULL, 0x11A4089E902D503CULL, 0x62D74C326F0E4082ULL, 
+		0x05B648C5160A4CF9ULL, 0xC64CC9CE43BCA6A5ULL, 0x0B9D1950C684ADB2ULL, 0x6E09F8C84B4FE7BEULL, 
+	},
+	// SBAS PRN 125
+	{
+		0x79FD67617634C20EULL, 0x675585012C77B389ULL, 0x6B2D9FD7E19B5D6BULL, 0x2FC315E42C49E450ULL, 
+		0xFFBD993AE76FE89AULL, 0x33996252E066D3E0ULL, 0xF8B768DF3D4A1EA8ULL, 0xA23A0D55A66BA8BEULL, 
+		0x905C88E1A49D3E4BULL, 0x7CEA7C4A012DFA00ULL, 0x99543700A3C53B4AULL, 0xC5298CA4209BF6F4ULL, 
+		0xC7C160E841CB125CULL, 0x3BA5D20B7F0B18C7ULL, 0x36E24D004C459B20ULL, 0x7B5BFB599F2B76D2ULL, 
+	},
+	// SBAS PRN 126
+	{
+		0x758B3FFFFD854740ULL, 0xE8567CE212F104E7ULL, 0x14C196B318C03A03ULL, 0x08B19731505C0E0AULL, 
+		0x212C25692C140EB6ULL, 0xE46C275A4C75BACFULL, 0xAD9751C27B03086BULL, 0x4B49FF33060E990FULL, 
+		0x3C27D6946DD7D16BULL, 0xE98C6476DEA4C2D5ULL, 0xFE548F594DFD56BFULL, 0xFC5CFDB721837272ULL, 
+		0xE688CE7278063AA1ULL, 0xA2B592A92B33A55CULL, 0xDEE10CBA9CFB41BBULL, 0x3DC2832E6768953CULL, 
+	},
+	// SBAS PRN 127
+	{
+		0xB1AF0CC7F8478831ULL, 0x81119529B9799CEFULL, 0xD12D4FB955B4EBCDULL, 0xFE654BF9D2591CABULL, 
+		0x3E3352293619D833ULL, 0x22791D6E87B6050DULL, 0xB74AE9F3A2617245ULL, 0x26D45D0F09E915F5ULL, 
+		0x6B8EBF6BDDF2428EULL, 0x0614D4EB14AF9725ULL, 0xB3F030230B0C1992ULL, 0xD807F2E8F49750C2ULL, 
+		0x724E0B26F8E24FB8ULL, 0x8909110CE4FA3FDDULL, 0xFA025A0B7182969EULL, 0x5C75557BFF086642ULL, 
+	},
+	// SBAS PRN 128
+	{
+		0x73D824EAAF86D694ULL, 0x7CF88EEC85CE228DULL, 0xEC521BE9DF75DD5FULL, 0xEB374868063D8DC7ULL, 
+		0x30A46D0F5C1F8B28ULL, 0x78BEA889DB22ABFFULL, 0xEE1C88706F99E1C8ULL, 0x40A4568A970A932AULL, 
+		0xB819E87AEDE3CAC6ULL, 0xB4004E02B73345AAULL, 0x0A6134292E4F924BULL, 0x3687C6F3599CBD6BULL, 
+		0x06279CA187667186ULL, 0xF96AA3C810A7B3F7ULL, 0xBE7A45C46876A325ULL, 0x0F8A3530D8C2BD79ULL, 
+	},
+	// SBAS PRN 129
+	{
+		0x76A2B27554848FAAULL, 0xA20105E5596E97D2ULL, 0xE888501E7B1AC9ADULL, 0x7972F89DFB6CCFECULL, 
+		0x29E8015A1411CC79ULL, 0x2A0560B387DE3257ULL, 0x0C52BD1B714E7CBAULL, 0xCEBF2BEFCE8C9C1DULL, 
+		0xFE38C9E32DCDDCBDULL, 0xC74A714CEA6F016AULL, 0x044E52E17C2434C5ULL, 0x193160151D8C95FEULL, 
+		0x16DF671B87B61F32ULL, 0x8F5A0A19B6F9AE09ULL, 0x6EACA805E6BDB0F4ULL, 0x24E6D82138BD811EULL, 
+	},
+	// SBAS PRN 130
+	{
+		0x4713E7556D99C9E3ULL, 0x4D21EC96AB0837B7ULL, 0xD05DFC65256F00E7ULL, 0x14876DFBE3501065ULL, 
+		0xAD6E665AAC482241ULL, 0x02F859C6F6CD334FULL, 0xB1C99C52DFD44577ULL, 0x1424B2FF8E2EC825ULL, 
+		0x1DD621E06C770C03ULL, 0x05ED37D59218F929ULL, 0x5FF954DA506B711DULL, 0xAA852794E17D0ABDULL, 
+		0xE3F258ED8304639FULL, 0x7C4C19A0F7931003ULL, 0xDA3B474D38945549ULL, 0x2F8733DB9A39D717ULL, 
+	},
+	// SBAS PRN 131
+	{
+		0x0D2CA90831DD09A5ULL, 0x624724C4C0AEB9C4ULL, 0x66FB1A21354795E9ULL, 0xEC7CD7FB333EA44AULL, 
+		0x9DC7B7FCF255DC51ULL, 0xD41598483DDEE239ULL, 0xDD248DB2A0E822A7ULL, 0xA96FFD020F02570EULL, 
+		0x6113A50E3C2DA381ULL, 0x68C8CC07A5928046ULL, 0x7D212E24F8CA649FULL, 0x0CB30D30E65EA274ULL, 
+		0xBE1645C3FD48B793ULL, 0x5B56AC2F9C5DA92AULL, 0xD785F5E1FB93CEB8ULL, 0x3F17FF3B8D32EAD0ULL, 
+	},
+	// SBAS PRN 132
+	{
+		0x5A3D9919B9956FD5ULL, 0xF8AE875812216A53ULL, 0x62F13F62BE9E27FDULL, 0xD8677AF0DE971DDBULL, 
+		0x0A40C878CC6B32D1ULL, 0x66D16C15B1F49650ULL, 0xC2EB9446955352C4ULL, 0xC924DAC8D4391376ULL, 
+		0xF5050EEE937F707EULL, 0xE52A525C7AA3E17DULL, 0xD7096B4463831A6BULL, 0x0D7BE702AEE8BCCBULL, 
+		0x218570C0D4C53D3AULL, 0x81A50265CB24AE61ULL, 0xE744131DB25563DBULL, 0x3AD5304A4E5D467BULL, 
+	},
+	// SBAS PRN 133
+	{
+		0x3668D117FEC4FD90ULL, 0x3094DBA48B89731FULL, 0x579A21B523EC7546ULL, 0xA5022376D1A0FF95ULL, 
+		0x2BD90856DA10BCCAULL, 0x599F3149F534D071ULL, 0xA423C62D33DD218EULL, 0x6FC29ED8FCAC1D59ULL, 
+		0x0EBF0E3EFDCB5FC8ULL, 0x4CFBF402675DF185ULL, 0x3AC8E58F70526C5BULL, 0xE06A077D928F6C1DULL, 
+		0x6ACA8D41F85A1656ULL, 0x4421EC35918B2CDCULL, 0xC2BFC12A382C0CA7ULL, 0x62AFCEE2EF48C416ULL, 
+	},
+	// SBAS PRN 134
+	{
+		0x55624C0D9B252271ULL, 0x3DFA07BC67384E08ULL, 0xE154F0AB241FB33BULL, 0x8ED6978909B23667ULL, 
+		0xDC1550183F151632ULL, 0x7F4D6EF4D64C77E7ULL, 0x360E4182D95730D6ULL, 0xA5A1FC72BCDE27D5ULL, 
+		0x9B614FEC1A2F9288ULL, 0x5E8A5F5A91E11A17ULL, 0x4A130EA5BC6215E4ULL, 0xD1630BB393FFDFC1ULL, 
+		0xF09B773312B83054ULL, 0x355ADA7702D618AFULL, 0xBF0AF61818AD480FULL, 0x65681332E9CBB1B7ULL, 
+	},
+	// SBAS PRN 135
+	{
+		0xFE82E35F48DA423AULL, 0xA3A1D88D0603DA1EULL, 0xA4346BE25AEB3ED9ULL, 0x64E4DF3F170D9C4FULL, 
+		0xE9167995B5BC17FAULL, 0xD107398DD107E874ULL, 0xD0F208447434EA25ULL, 0x6AD03F1D10751714ULL, 
+		0x03698BC82917974AULL, 0x8F44361D782AB19FULL, 0x58B2CB4965685890ULL, 0x07E6FD674F375DC4ULL, 
+		0x4F59682C65F82A59ULL, 0x4F741C6238E2D36CULL, 0x33F0ECC5A09C916DULL, 0x768D7EAF4BF7BE50ULL, 
+	},
+	// SBAS PRN 136
+	{
+		0xDD421D27877BEFE1ULL, 0x3C5ADAD4385503C4ULL, 0xADE8CB5705EE444FULL, 0x9340B02BE5D365C4ULL, 
+		0x1CEB28D79EB8CDB1ULL, 0x844F37CA8095ADC4ULL, 0xEAAEF4DDDC2DA649ULL, 0x01CEE8806227ACDCULL, 
+		0x66300DC71EF5D97FULL, 0x1684180B03A4AAE2ULL, 0x16EF970DA52E79B1ULL, 0xCFB496C1C14417FBULL, 
+		0xA91D7804F0F6053FULL, 0xF574CC0C8CCD65CAULL, 0xE256B2D85E8C6996ULL, 0x3703B5BC9A818EF9ULL, 
+	},
+	// SBAS PRN 137
+	{
+		0x2EEC5770FE7CA47EULL, 0xFDBC269DFEF8601EULL, 0x6F27BA946A42EF7FULL, 0x1BD8B8EFC1E05DC1ULL, 
+		0x683AE6BED951061AULL, 0x815D960F6C4CA789ULL, 0xE778712B08F16ECBULL, 0xC2712A9F7D50ECC6ULL, 
+		0x044A23010BCFEDB4ULL, 0xF108E211DE1C9B3BULL, 0x337C7260388C45BEULL, 0xC4E16696682DE84BULL, 
+		0x585255EB684698F5ULL, 0xE1567C4128721F8CULL, 0x0623ABFC05833643ULL, 0x7E9934285C44DA79ULL, 
+	},
+	// SBAS PRN 138
+	{
+		0x3A76BED362AE2BADULL, 0x6CB82CB8BD73B9ACULL, 0xEF13A13961AF46C6ULL, 0x724F3F9045DE632FULL, 
+		0x0B88224A84DD2C6EULL, 0xF942591698791CF9ULL, 0x18183A0CC22A558FULL, 0xF9E53C349DFFBE15ULL, 
+		0xF0C7C19F5010DCD5ULL, 0x4EA2CA54BE87D245ULL, 0x9A7DBA8A0AC4F3A0ULL, 0x8F7EF5A36B0465C1ULL, 
+		0x3B88A6452211E1F2ULL, 0x4A66BDA7D43BD921ULL, 0x3E266933744059EFULL, 0x3532BCB05480FE4AULL, 
+	},
+	// SBAS PRN 139
+	{
+		0xE03D49770DBAD973ULL, 0x2908D945EC3192A8ULL, 0xA37FF4716FE81754ULL, 0xC98705CCB947CB36ULL, 
+		0x45BD495453405E3CULL, 0xE23F3C4F1E762B1BULL, 0x3939A3CCEC3C2E01ULL, 0xB3DA7269C1BB7E53ULL, 
+		0xDFA109CD3BB652A6ULL, 0xF8042C10AEAF474BULL, 0x6286008ADAAA478FULL, 0xBFD7240535199BD1ULL, 
+		0xED6567CBE9023084ULL, 0x268BAC47AB07BEF1ULL, 0x836D26CEF56CC6C4ULL, 0x49F7385E04DA51C8ULL, 
+	},
+	// SBAS PRN 140
+	{
+		0xC3FDB70FC21B74A8ULL, 0xB6F3DB1CD2674B72ULL, 0xAAA354C430ED6DC2ULL, 0x3E236AD84B9932BDULL, 
+		0xB040181678448477ULL, 0xB77732084FE46EABULL, 0x03655F554425626DULL, 0xD8C4A5F4B3E9C59BULL, 
+		0xBAF88FC20C541C93ULL, 0x61C40206D5215C36ULL, 0x2CDB5CCE1AEC66AEULL, 0x77854FA3BB6AD1EEULL, 
+		0x0B2177E37C0C1FE2ULL, 0x9C8B7C291F280857ULL, 0x52CB78D30B7C3E3FULL, 0x0879F34DD5AC6161ULL, 
+	},
+	// SBAS PRN 141
+	{
+		0xB6E49354CD44A1BCULL, 0x2C724FDA1733CB96ULL, 0x7D867F78B348A20BULL, 0xCD5D4E3B1D28DFC4ULL, 
+		0xD7F8F9A1AE111C17ULL, 0xFB73501A56786C4AULL, 0x6B826BF6B0C0B7A9ULL, 0x51944702DF6CE321ULL, 
+		0x51BA74A862305D91ULL, 0xBE250D896E815130ULL, 0x11CC3FC487F6034FULL, 0xB1F842CD67723D5FULL, 
+		0xC2D3C12DAD121811ULL, 0x367357FDABD7D045ULL, 0xF55D8F1F5332DB3AULL, 0x1921D59F8A114219ULL, 
+	},
+	// SBAS PRN 142
+	{
+		0xC1A489591BC15768ULL, 0x16468419A8F1D489ULL, 0xC5B7A61AC966641EULL, 0x6F6141DC91D2C519ULL, 
+		0xBE0749843DF4718AULL, 0x4BEE9A1103883BE3ULL, 0xD4F82D07FFED5831ULL, 0x5ECB9216FDDCAE85ULL, 
+		0x94EEF44C172979CAULL, 0x3D80C240F400C5F6ULL, 0x477DD2BD50D328F3ULL, 0x67ADDAAD940C19BCULL, 
+		0xDB4FC3CCCAAAF9A6ULL, 0xC2968239E7D3B257ULL, 0x99D8A9A53BD5EF99ULL, 0x7745949D0341A0EFULL, 
+	},
+	// SBAS PRN 143
+	{
+		0x5E5F8B0025978EB2ULL, 0x1F9A24ACF7F4AE1FULL, 0x3213C90E3BB89D95ULL, 0x9A9C109EBAD61F52ULL, 
+		0xEB4F47C36C66343AULL, 0x71B26688AB91778FULL, 0xBFE6FA9A8DBFE3F9ULL, 0x3B921419CA3EE0B0ULL, 
+		0x0D2EDA5A6CA762B7ULL, 0x73DD9E043446E4D7ULL, 0x8F2FB91BDEA062CCULL, 0x81E9CA85010236DAULL, 
+		0x614F13A27E854F00ULL, 0x1330DC2419C34AACULL, 0x585662B6EAA3DF30ULL, 0x66A5EBA164917602ULL, 
+	},
+	// SBAS PRN 144
+	{
+		0x25B9A72757155BCEULL, 0x0CF30B726648FDD4ULL, 0x7B050AD9CEFD9539ULL, 0xFFADA1CB9AEF0214ULL, 
+		0xA1A0672A1F94529AULL, 0xF88AB324D0CF0246ULL, 0x878B0F0FEBA7DF26ULL, 0x2316927ECA86B95EULL, 
+		0xC006276319D671B6ULL, 0x4B6005257DE87EEEULL, 0x31F52282CEE0C098ULL, 0xC20A246D02438C0AULL, 
+		0xB98DB4E4E7FD38F8ULL, 0x506B6B2222EF05E9ULL, 0xF5E5D6F16B5F2EAFULL, 0x6C50C69E9295C47EULL, 
+	},
+	// SBAS PRN 145
+	{
+		0x88B24A8EEE845FC4ULL, 0x7377354C88C8C9CFULL, 0x8F5886F3BA9402BEULL, 0xE6599470EA8CB0D0ULL, 
+		0x866ABC115BEC4D55ULL, 0x536A1C760330620DULL, 0x19D0D03E8A9C4B30ULL, 0x66760937B47234BCULL, 
+		0x2A346FD50769DB9EULL, 0x7E632CA8F7417F26ULL, 0x9FBF75FBC9AB5F0BULL, 0x24F66DABAF2056F9ULL, 
+		0x76FC778B4B560839ULL, 0xC863AF0611D7002BULL, 0x242BBFB682948527ULL, 0x7EF103724B9F890AULL, 
+	},
+	// SBAS PRN 146
+	{
+		0xDA61B5EEA5A3951FULL, 0x42160ED89E632960ULL, 0xC626727E580A5961ULL, 0x50472BDAC2C9D04BULL, 
+		0x0BE0151093067F1DULL, 0x2A6D57E990056124ULL, 0xDF7DB3E479320167ULL, 0x09DAA2077594C8F5ULL, 
+		0x0E0757D0C5A6AA5DULL, 0x398AE7037FD977E2ULL, 0x73667FB6BD7A9162ULL, 0xF02AA529AA32F73CULL, 
+		0x698B379146808DCFULL, 0xDD599BCDD268C234ULL, 0xF9938E6FE0EEABE1ULL, 0x63533F7DAC137310ULL, 
+	},
+	// SBAS PRN 147
+	{
+		0x3459D81B30C58D23ULL, 0x430E8A5EF9639139ULL, 0xFFEB5A83617F2872ULL, 0x047F9641E3807ED1ULL, 
+		0xDB5ECF8B0A163FBFULL, 0xD22EB4077806209EULL, 0x9AA571433FAB7910ULL, 0x9699F9B073AFE4BAULL, 
+		0x72AAE464822756ACULL, 0x8780122E402F7350ULL, 0x96DB8CA0AEC3D008ULL, 0xA62311BE457A2915ULL, 
+		0xCAAFBCF0AD7A2F4BULL, 0x8D6B031578F8DEBAULL, 0x1D36F9FF945752D2ULL, 0x0C97A3177A2EDC2AULL, 
+	},
+	// SBAS PRN 148
+	{
+		0x8785A8C0DBEF4113ULL, 0x650CBB57F5AD9049ULL, 0xCB98C0D29B0DC290ULL, 0x40D7E73AD5C2ED8CULL, 
+		0xAEFFB23E3D241F3EULL, 0x3DDE33C0A5D6261DULL, 0x042EC0C671264BE0ULL, 0x75A77F071DA392E2ULL, 
+		0x1653BF03EAA85555ULL, 0x52FC07C41A509F59ULL, 0xC510F74682E4A28AULL, 0xAE8F02D76AA4B8A9ULL, 
+		0xD7E9F5E66EADDA0EULL, 0xEBCB6624C9ADFE83ULL, 0x68FFB310B4BE2120ULL, 0x30482A2FAF82A774ULL, 
+	},
+	// SBAS PRN 149
+	{
+		0xBF3833E19241DB2AULL, 0xDBD620CEE5ED321DULL, 0x887B2E3A984C7840ULL, 0x9815407C4CBA9A74ULL, 
+		0xEDA405380608507BULL, 0x906D8787242AD782ULL, 0x0EDBEDF98722F99CULL, 0xC8546914A4E2F85CULL, 
+		0x1FE728ECA2767CB0ULL, 0x7677662FE0F21B0FULL, 0xF7882FEC12F82C29ULL, 0x0BF892A3D35D8BF9ULL, 
+		0x13759F305302E0EAULL, 0xF7FD9CEE7AA1E0ECULL, 0xE4BDF02334E20DD7ULL, 0x56DC54B3153A2EF4ULL, 
+	},
+	// SBAS PRN 150
+	{
+		0xA6CC065AE22269EEULL, 0xFC1CFBF5A1952DD2ULL, 0x239B81684BB3180BULL, 0x064E9F4D2D810E62ULL, 
+		0xA8C49E7178FCDD99ULL, 0x7A5FCF313A957DAAULL, 0x3BD8C4740D8BF854ULL, 0x661E3E6DA3A967CFULL, 
+		0xF91B612A0F15A643ULL, 0xB906A5404C592BCEULL, 0x6F80EBC821C029EBULL, 0xDA36FBE43A962071ULL, 
+		0x01D45ADC8A08AD9EULL, 0x21786A3AA66962E9ULL, 0x5B7FEF3C43A217DAULL, 0x2CF292A62F0EE537ULL, 
+	},
+	// SBAS PRN 151
+	{
+		0x02A312A83CDBE2E7ULL, 0x014DB9DEA54F6625ULL, 0x6B95C639D9F6A8FEULL, 0x5AB206E534CD6237ULL, 
+		0xB61303032A4715A3ULL, 0x23D9C006D8DB48C1ULL, 0xFBF6D20F83908531ULL, 0x3B427AADE5884656ULL, 
+		0xAB70C7A47C5F990DULL, 0xFD168DD542764D06ULL, 0x6F50857C0E768F0DULL, 0x7C68E61A2A6EDBCBULL, 
+		0x8F1F490DFC38044FULL, 0xC107565D76BF8F28ULL, 0xA6FEC3A368CEFACBULL, 0x42A2C809ADB3AE78ULL, 
+	},
+	// SBAS PRN 152
+	{
+		0x5623F6DD25FFB9E8ULL, 0xA482704424DBA0E0ULL, 0xDA78BFEEFCDD147DULL, 0x0F2A66164AE98161ULL, 
+		0x2A11E26492A6A275ULL, 0xC60C044ADCB95AD8ULL, 0x7ED0686764A426C5ULL, 0x5F037824B56AB03AULL, 
+		0x0B7DC14F3EA4F363ULL, 0xE7736C0AA379C2BDULL, 0x77BC344119158590ULL, 0x626F15DC5763B517ULL, 
+		0x70C75BC40E8ECA9EULL, 0x8FE253F78E945B9CULL, 0x1BDDBB04FE393693ULL, 0x6D484218F5957C27ULL, 
+	},
+	// SBAS PRN 153
+	{
+		0xF2F4BBC1C36BC774ULL, 0x2CA2216E38856D70ULL, 0xDBD86286A3B059B1ULL, 0x43965DEA6B187615ULL, 
+		0x3787C5C67EC7F1D6ULL, 0x06F27C857D14815BULL, 0x85D23159327DFCE6ULL, 0x83A3CD7BB01026A5ULL, 
+		0xAF12D5BDE05D786AULL, 0x1A222E21A7A3894AULL, 0x3FB273108B503565ULL, 0x3E938C744E2FD942ULL, 
+		0x6E10C6B65C3502A4ULL, 0xD6645CC06CDA6EF7ULL, 0xDBF3AD7F70224BF6ULL, 0x301406D8B3B45DBEULL, 
+	},
+	// SBAS PRN 154
+	{
+		0x398F5DEDE41945A1ULL, 0x80B14841E614D123ULL, 0x9D91744574451CB9ULL, 0xE3F36C5B3E384F08ULL, 
+		0xFECD2AE697B403B0ULL, 0xD97B4450D16FDF2EULL, 0x6BEA5CACA71BE4DAULL, 0x82BB49FDD7109EFCULL, 
+		0x96DFFD40D9280979ULL, 0x4E1A93BA86EA27D0ULL, 0xEF0CA98B124075C7ULL, 0xC6D06F9AA62C98F8ULL, 
+		0x2BC804111AAC7AD3ULL, 0x492707776AE142B8ULL, 0xA75E1ECB37A3B707ULL, 0x0E1EF3F58C42590CULL, 
+	},
+	// SBAS PRN 155
+	{
+		0xCF5B8125661C5700ULL, 0x9FAE3F01FC1907A6ULL, 0x5B844E71BF86A37BULL, 0xF92ED46AE75A3526ULL, 
+		0x935088DA98538F4AULL, 0x8ED22DAF614A4CCBULL, 0x8472EC316D10B12AULL, 0xCF1FF68791E1D1D1ULL, 
+		0xB284F21F0C3C2BC9ULL, 0xDADC56EE060E52C9ULL, 0xC4B02A2EDD89EF46ULL, 0xE233392B4B554FDDULL, 
+		0xCA7FD24482CC89ADULL, 0x2B351EEB68002500ULL, 0x93FDEA2EE267FB03ULL, 0x6CE89F70AAF831EBULL, 
+	},
+	// SBAS PRN 156
+	{
+		0xFB90429AA4034877ULL, 0xAE775D7BD2DF129CULL, 0x678BA9FD459C7EC3ULL, 0x069EF1F90237A884ULL, 
+		0x0E9A838F68042623ULL, 0xF494DCE04CA5D47BULL, 0xDBA7F813DD5D1595ULL, 0x9B9F12F288C58ADEULL, 
+		0x174B3B858DA8ED0CULL, 0x6B312F392325EE4AULL, 0x91284ADDA3AD0C10ULL, 0x7E31D84CF3B4F80BULL, 
+		0x2FAA160886AE9BB4ULL, 0xAE13A4838F3486F4ULL, 0xF7BCE8A7B2850D6FULL, 0x4CE5999BE8035B85ULL, 
+	},
+	// SBAS PRN 157
+	{
+		0x5A55AE43AE4E3CA6ULL, 0x2B8189A71A5D178EULL, 0xA594B68A05867315ULL, 0x2858E4C336FC6B3BULL, 
+		0xF4805E3759DD4459ULL, 0x11F9414270AA33F7ULL, 0x2BF0517A22ED3006ULL, 0xB6708A42150F818BULL, 
+		0xA7069F3AF7EE1C43ULL, 0x721574367CF0FA68ULL, 0x10BC8C18F72DE865ULL, 0x5B1A64CF567B3191ULL, 
+		0x518EF55E3743E263ULL, 0x16F21355DAACE607ULL, 0xF3DEFABE2E87EC08ULL, 0x2BD13A6F0DD69FC9ULL, 
+	},
+	// SBAS PRN 158
+	{
+		0x7AD4EAEBDF350AE4ULL, 0x2D02FC0667E820BCULL, 0x9764597A8241AEC5ULL, 0x5E007A48877925B6ULL, 
+		0xF779BD09DF6A2A55ULL, 0xFDF025BB2BCD5B78ULL, 0x5972840637076A79ULL, 0x27CCD9896EE9ADACULL, 
+		0x52439796E487339DULL, 0x522C697035E639BFULL, 0x634EEAB8921C5930ULL, 0x204411061C941178ULL, 
+		0x3796C981BE7B37CFULL, 0x164A4ABBE2C11392ULL, 0x86AFE9BF36036A6FULL, 0x627FA056C0FE62F0ULL, 
+	},
+	// QZSS PRN 193
+	{
+		0x420146908140C3AEULL, 0x40F769607FD4FF35ULL, 0x13E23E7A3A1840FDULL, 0x76FD433DF66A24AEULL, 
+		0x4AE29C4071F01398ULL, 0x276BBCAB6B6F0F40ULL, 0xBA9C6C0576BDBAC7ULL, 0xE56B9F10169E55EFULL, 
+		0x09F491ADC8C87645ULL, 0xE1982EF1C917A6FCULL, 0x9663D54E96AE259DULL, 0xD35202BF5DFEAF72ULL, 
+		0x830126C96052D272ULL, 0x9D2BA1414045459BULL, 0x1E77432F2A8DC94BULL, 0x15EFD4EF39CD32C2ULL, 
+	},
+	// QZSS PRN 194
+	{
+		0xDE03A7F739A17478ULL, 0xA522AD2C7BB6ED2CULL, 0x96C48412DD2CE309ULL, 0x12BC41B4A688D2C2ULL, 
+		0xEAEF9AAB330B79F6ULL, 0x3D0E5D748A6080FBULL, 0xA270DD3861DEB05AULL, 0xFB6C6CD66B933B33ULL, 
+		0xF62C83643A7EB894ULL, 0xAF7D2B5B313C7248ULL, 0x2B40ADE90059E9C5ULL, 0x7CB888AE05D87D2DULL, 
+		0x294154F3ECC0FFF5ULL, 0x4FCC458C008F26F9ULL, 0x4681FFC4B818170AULL, 0x3F23E49686DF4369ULL, 
+	},
+	// QZSS PRN 195
+	{
+		0xD9F0618A34CFA860ULL, 0x7D3064DECD783C32ULL, 0x73C12EEAF6F857F6ULL, 0x31C4E62251448A8CULL, 
+		0x00658BF315D9264BULL, 0x7D7C67F8184D0754ULL, 0x45941078ABBDD2F0ULL, 0x0DD08744FE4D7AE1ULL, 
+		0x3A1CFADB280F13CCULL, 0xAE0D988741E79962ULL, 0xC1A28BEB3150E50BULL, 0xEFE5BCDD9F89875FULL, 
+		0x09C0105B9DBBC9B7ULL, 0x494F302D7D3A11CBULL, 0x747110343FDFCADAULL, 0x497B7A1D375A0DE4ULL, 
+	},
+	// QZSS PRN 196
+	{
+		0x5C06B556FC4DAD72ULL, 0xBF2F7BA98D6231E4ULL, 0x5D073BD0C2339449ULL, 0xCBDE3B9A609DE8F6ULL, 
+		0xE508165129D6C1C7ULL, 0x8D2BCE91E7FD22C7ULL, 0x687B88C83677D9A5ULL, 0xBD9D23FB840B8BAEULL, 
+		0x2338A1D477DA07EEULL, 0x2F995E4215677D17ULL, 0xE4893768949F2C91ULL, 0x91C15F8B2E64FE88ULL, 
+		0xB121A78DC823A944ULL, 0x4D2D2234E138F0ACULL, 0x9345B3C0DA0A0E96ULL, 0x19998C71B27CB78CULL, 
+	},
+	// QZSS PRN 197
+	{
+		0xE9E1E9C252BFA3E5ULL, 0xDEACB6511EEF6B23ULL, 0x5682A53344ECCD1FULL, 0x9CCF0B8BE8D58E86ULL, 
+		0x7FE1B5CDFB591250ULL, 0x8921EBD26C2490D3ULL, 0x5C6025C3DBDE6034ULL, 0x2A1A5C7FBA35652EULL, 
+		0x91FC5589FBF07387ULL, 0x305647B620DC0D74ULL, 0x84C210A24FA468E9ULL, 0x05D7F46B81362D77ULL, 
+		0x3CC339D61712C87FULL, 0xE70567547A718E58ULL, 0x928D59F292BC1029ULL, 0x060AB9729BF13D25ULL, 
+	},
+	// QZSS PRN 198
+	{
+		0x094EBB11ADDFE8C2ULL, 0x85738730257B7D88ULL, 0x3619EC4DB0612F81ULL, 0xAE87BD95577FA6C3ULL, 
+		0x7CC838475258DABAULL, 0xC37692D527BB03E6ULL, 0xA029E36EB804939AULL, 0x5BD933D31105A4C8ULL, 
+		0x993871BAC3F5B148ULL, 0xFE3F005FEB7785ECULL, 0x2507FC7B45E91C38ULL, 0x802120B749B42865ULL, 
+		0xFEDC26A15708C5A9ULL, 0xC9C3726E4EBA4DE7ULL, 0x6897844AA3657253ULL, 0x636724D0A7FEDAA9ULL, 
+	},
+	// QZSS PRN 199
+	{
+		0xD617ED702E121051ULL, 0xCD15F73BA0E59E0EULL, 0xB9CA7B1AA1513E09ULL, 0x7735A90FBEDC3A11ULL, 
+		0xD571A943587D9931ULL, 0xFD9812E13C16080BULL, 0x8A5D8AF93F7B17A4ULL, 0xE0A95061D5F1F944ULL, 
+		0xA27C09A50CEC457DULL, 0xACECFF3FA0504F37ULL, 0x1466C7EF5342FC97ULL, 0xC95FD43AAB2A73BAULL, 
+		0x48C2990B7F4DA532ULL, 0x4449DB6F86507FAFULL, 0x1190CFD53050717AULL, 0x25CA470A545090FEULL, 
+	},
+	// QZSS PRN 200
+	{
+		0x95246D2C02E50C67ULL, 0xB3894D832965124CULL, 0x745ADFCDEC4DD89DULL, 0x3AF9212FEFF6264FULL, 
+		0x2205A8E38515C65CULL, 0xAE3B5E5D07EA29FAULL, 0x51DE976F18D9FBC5ULL, 0x3A8A909FAD3E58E9ULL, 
+		0x34E3F2A755D213A4ULL, 0x27E5239F150F4A4DULL, 0x5F91638047B0226EULL, 0x79AA296BE9017760ULL, 
+		0x2497D105381C3777ULL, 0x8C7387931FF866E3ULL, 0x24FBD102AD2223C1ULL, 0x58AF1E8C5B6772B0ULL, 
+	},
+	// QZSS PRN 201
+	{
+		0x44525D85D343527AULL, 0xD4599B6EE8EBD95FULL, 0xEB71B320FDADA7A1ULL, 0x957B9C64A00BA763ULL, 
+		0x5B6AD42601FB9606ULL, 0xBBB93378FC381E70ULL, 0xF917B5B762275364ULL, 0xEE8636A9879A5FCAULL, 
+		0x8DCAAF4348FC6DE8ULL, 0xBC140485A0802183ULL, 0x62566E3EF51CE169ULL, 0x198939FB25E1606BULL, 
+		0x63AE741A9F329955ULL, 0xC6F490207BD15330ULL, 0x7EEC0A51DE002BD5ULL, 0x27A762F186671A87ULL, 
+	},
+	// QZSS PRN 202
+	{
+		0x6F5687CE24E73D6EULL, 0x85CBDEDE1D16881DULL, 0x4368FF4CA8E5A9E6ULL, 0xE72927AC9A575BFAULL, 
+		0x6C889A136AE5419BULL, 0xC03728059961987FULL, 0x39519496FBE77D72ULL, 0x60F57C96C9C7038EULL, 
+		0x18C4802580AE064EULL, 0x083BB22346C431ABULL, 0x9C4696C54F1C3107ULL, 0xC8FF0952F4473E76ULL, 
+		0x047EA2F75EBC5246ULL, 0x59DFFCCD6A312C0CULL, 0xD16EB71A91FDAAF9ULL, 0x5EC81E3402894ADDULL, 
+	},
+};
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef H_CAPTURE
+#define H_CAPTURE
+
+#include <stdbool.h>
+
+// How often (in seconds of samples) a capture file's index gets an entry
+#define CAPTURE_INDEX_INTERVAL_S    (1.0)
+
+// Where and how capture files are written (see capture.c)
+// NOTE: A maxFileBytes or maxFileDuration_s of 0 means no limit. With neither set everything goes into one file.
+typedef struct {
+    const char* filename;
+    long long maxFileBytes;
+    double maxFileDuration_s;
+    bool directWrites;
+    int writeDepth;
+} CaptureOptions;
+
+typedef struct CaptureSink CaptureSink;
+
+CaptureSink* captureOpen(const CaptureOptions* options);
+int captureWrite(CaptureSink* capture, void* data, int size, int sampleCount, gtime_t time);
+int captureClose(CaptureSink* capture);
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef H_CODETABLES
+#define H_CODETABLES
+
+#include <stdint.h>
+
+// Code tables hold every SV's C/A code already sampled at the output sample rate (see codetables.c)
+// NOTES:
+// 1. CODE_TABLE_DOPPLER_BIN_COUNT tables are made per SV, spread evenly over +/-CODE_TABLE_DOPPLER_SPAN_HZ of code Doppler.
+//    Runs are at most CODE_TABLE_MAX_RUN_SAMPLE_COUNT long, over which even a 5 Hz rate error moves the code by about a
+//    thousandth of a chip, so a single bin is the default and the cache goes on phase offsets instead.
+// 2. The number of fractional phase offsets per bin is picked at startup so the active channels' tables fit in CODE_TABLE_CACHE_BYTES.
+//    The code phase is rounded to within 1 / (2 * offsets) of a sample.
+#define CODE_TABLE_DOPPLER_BIN_COUNT        (1)
+#define CODE_TABLE_DOPPLER_SPAN_HZ          (5.0)
+#define CODE_TABLE_CACHE_BYTES              (1024 * 1024)
+#define CODE_TABLE_MAX_PHASE_OFFSET_COUNT   (16)
+#define CODE_TABLE_MAX_RUN_SAMPLE_COUNT     (1024)
+
+void initCodeTables(SV* svs, int svCount);
+void freeCodeTables(void);
+void generateCodeTableSignMask(const SV* sv, uint64_t codePhase, uint64_t codeRate, char navBit, int32_t* signMask, int sampleCount);
+
+#endif
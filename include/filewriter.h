@@ -0,0 +1,16 @@
+#ifndef H_FILEWRITER
+#define H_FILEWRITER
+
+#include <stdbool.h>
+
+// Writes are gathered into chunks of this size, each submitted as one write. A multiple of the O_DIRECT alignment.
+#define FILE_WRITER_CHUNK_BYTES     (4 * 1024 * 1024)
+#define FILE_WRITER_ALIGNMENT       (4096)
+
+typedef struct FileWriter FileWriter;
+
+FileWriter* fileWriterOpen(const char* filename, bool direct, int depth, long long preallocateBytes);
+int fileWriterWrite(FileWriter* writer, const void* data, int size);
+int fileWriterClose(FileWriter* writer);
+
+#endif
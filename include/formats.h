@@ -0,0 +1,28 @@
+#ifndef H_FORMATS
+#define H_FORMATS
+
+// Sample formats the IQ output can be written in (see formats.c for the layouts)
+enum {
+    OUTPUT_FORMAT_INT16,
+    OUTPUT_FORMAT_INT8,
+    OUTPUT_FORMAT_INT4,
+    OUTPUT_FORMAT_INT2,
+    OUTPUT_FORMAT_FLOAT32
+};
+
+// How to turn the simulator's 16-bit IQ values into the output format
+// NOTES:
+// 1. Every I and Q value is multiplied by scale and rounded, then limited to +/-clipLevel
+// 2. A clipLevel of 0 uses the full range of the format. clipLevel is ignored for FLOAT32
+typedef struct {
+    int type;
+    double scale;
+    int clipLevel;
+} OutputFormat;
+
+int parseOutputFormat(const char* name, OutputFormat* format);
+const char* outputFormatName(const OutputFormat* format);
+int outputFormatBufferLength(const OutputFormat* format, int length);
+int convertIQSamples(short* buffer, int length, const OutputFormat* format);
+
+#endif
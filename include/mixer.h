@@ -0,0 +1,37 @@
+#ifndef H_MIXER
+#define H_MIXER
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// PORTABLE, SSE2, AVX2 and AVX-512 (see mixer.c)
+#define CHANNEL_MIXER_MAX_COUNT (4)
+
+// Mixes one channel's carrier into a block of 32-bit I and Q accumulators.
+// NOTES:
+// 1. signMask holds one entry per sample: 0 to add the carrier as-is, -1 (all bits set) to negate it
+// 2. carrierRate is added to carrierPhase after every sample, and carrierRateStep to carrierRate (see mixer.c).
+//    Both are left as they are after the last sample so the caller can carry them into the next block.
+// 3. mix ignores gain and adds the carrier at the trig table's amplitude. mixGain multiplies it by gain first
+//    (see CHANNEL_GAIN_FRACTION_BITS), so the accumulators hold CHANNEL_GAIN_FRACTION_BITS of fraction.
+// 4. mixBlock and mixGainBlock are the same but always mix exactly SYNTHESIS_BLOCK_SAMPLE_COUNT samples, whatever sampleCount says.
+typedef void (*ChannelMixerFunction)(int32_t* iAccumulator, int32_t* qAccumulator, const int32_t* signMask, uint64_t* carrierPhase, uint64_t* carrierRate, uint64_t carrierRateStep, int32_t gain, int sampleCount);
+
+// Shifts summed I and Q accumulators right by shift (rounding), saturates them to shorts and interleaves them into iqBuffer.
+// Returns how many I and Q values had to be saturated.
+typedef int (*IQPackFunction)(short* iqBuffer, const int32_t* iAccumulator, const int32_t* qAccumulator, int shift, int sampleCount);
+
+typedef struct {
+    const char* name;
+    ChannelMixerFunction mix;
+    ChannelMixerFunction mixGain;
+    ChannelMixerFunction mixBlock;
+    ChannelMixerFunction mixGainBlock;
+    IQPackFunction pack;
+} ChannelMixer;
+
+int supportedChannelMixers(ChannelMixer mixers[CHANNEL_MIXER_MAX_COUNT]);
+ChannelMixer selectChannelMixer(void);
+bool findChannelMixer(const char* name, ChannelMixer* mixer);
+
+#endif
@@ -0,0 +1,16 @@
+#ifndef H_NAVMESSAGE
+#define H_NAVMESSAGE
+
+// NAV frames are generated one subframe at a time, just before each one is transmitted (see navmessage.c)
+// NOTES:
+// 1. startNAVFrame() takes the TOW and WN for a frame. generateNAVSubframe() then encodes one of its subframes into the SV's navBitStream.
+// 2. advanceNavBit() moves a channel onto its next navbit, starting frames and generating subframes as they are reached.
+// 3. initNAVMessages() must be called once before any of the above.
+
+void initNAVMessages(void);
+void computeParity(unsigned long* word, unsigned long* previousWord, unsigned short solveNibs);
+void startNAVFrame(Channel* channel, gtime_t frameTime);
+void generateNAVSubframe(Channel* channel, int subframe);
+void advanceNavBit(Channel* channel, gtime_t simulationTime);
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef H_NOISE
+#define H_NOISE
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// PORTABLE and AVX2 (see noise.c)
+#define NOISE_GENERATOR_MAX_COUNT (2)
+
+// Adds white Gaussian noise with standard deviation sigma to a block of 32-bit I and Q accumulators (see noise.c)
+// NOTE: The noise on each sample depends only on seed and the sample's index in the run (firstSample for the first
+//       one), so a run gives the same noise however it's split into windows, threads or segments.
+typedef void (*NoiseFunction)(int32_t* iAccumulator, int32_t* qAccumulator, uint64_t firstSample, uint32_t seed, double sigma, int sampleCount);
+
+typedef struct {
+    const char* name;
+    NoiseFunction add;
+} NoiseGenerator;
+
+int supportedNoiseGenerators(NoiseGenerator generators[NOISE_GENERATOR_MAX_COUNT]);
+NoiseGenerator selectNoiseGenerator(void);
+bool findNoiseGenerator(const char* name, NoiseGenerator* generator);
+
+#endif
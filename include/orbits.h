@@ -0,0 +1,63 @@
+#ifndef H_ORBITS
+#define H_ORBITS
+
+// Kepler's equation is solved to the same tolerance and iteration limit as RTKLIB's eph2pos()
+#define ORBIT_KEPLER_TOLERANCE          (1E-13)
+#define ORBIT_KEPLER_MAX_ITERATIONS     (30)
+
+// GPS ephemerides in struct-of-arrays form, and a batch of orbit evaluations to do with them (see orbits.c)
+// NOTES:
+// 1. Add evaluations with orbitBatchAdd(), run them all with propagateOrbits(), then read the results out of the
+//    arrays at the index orbitBatchAdd() returned. orbitBatchClear() empties the batch for reuse.
+// 2. Results for each evaluation: SV position (ECEF), clock bias, pseudorange and elevation from the receiver.
+typedef struct {
+    int svCount;
+
+    // Per SV, with the terms eph2pos() works out on every call done once up front
+    double* meanMotion;
+    double* M0;
+    double* e;
+    double* A;
+    double* ellipseFactor;
+    double* omg;
+    double* i0;
+    double* idot;
+    double* OMG0;
+    double* OMGRate;
+    double* OMGOffset;
+    double* cus;
+    double* cuc;
+    double* crs;
+    double* crc;
+    double* cis;
+    double* cic;
+    double* f0;
+    double* f1;
+    double* f2;
+    double* relativityFactor;
+    gtime_t* toe;
+    gtime_t* toc;
+
+    // Per evaluation
+    int count;
+    int capacity;
+    int* sv;
+    double* toeOffset_s;
+    double* tocOffset_s;
+    double* eccentricAnomaly;
+    double* previousEccentricAnomaly;
+    double* meanAnomaly;
+
+    double* position_ecef[3];
+    double* clockBias_s;
+    double* psuedorange_m;
+    double* elevation_rad;
+} OrbitBatch;
+
+OrbitBatch* orbitBatchCreate(const eph_t* const* ephemerides, int svCount, int capacity);
+void orbitBatchDestroy(OrbitBatch* batch);
+void orbitBatchClear(OrbitBatch* batch);
+int orbitBatchAdd(OrbitBatch* batch, int sv, gtime_t time);
+void propagateOrbits(OrbitBatch* batch, const double* receiverPosition_ecef);
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef H_PACING
+#define H_PACING
+
+#include <stdint.h>
+
+// Keeps a stream of IQ windows running at real time (see pacing.c)
+typedef struct {
+    uint64_t sampleRate_Hz;
+    int64_t prerollTime_ns;
+
+    int64_t startTime_ns;
+    uint64_t sentSampleCount;
+    unsigned long windowCount;
+
+    unsigned long underrunCount;
+    int64_t totalLag_ns;
+    int64_t maxLag_ns;
+} StreamPacer;
+
+void initStreamPacer(StreamPacer* pacer, uint64_t sampleRate_Hz, int windowSampleCount, int prerollWindowCount);
+void paceStream(StreamPacer* pacer, int sampleCount);
+void reportStreamPacer(StreamPacer* pacer);
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef H_PERFCOUNTERS
+#define H_PERFCOUNTERS
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Stages of the simulation loop timed by the performance counters (see perfcounters.c)
+typedef enum {
+    PERF_STAGE_RECEIVER,        // Receiver position update
+    PERF_STAGE_ALLOCATION,      // Visibility check and channel allocation
+    PERF_STAGE_ORBITS,          // Satellite position and channel property updates
+    PERF_STAGE_SYNTHESIS,       // Filling the IQ window
+    PERF_STAGE_OUTPUT_WAIT,     // Waiting for a free output buffer (i.e. the sink holding synthesis up)
+    PERF_STAGE_OUTPUT,          // Converting and handing windows to dumpCallback (on the output thread, if there is one)
+    PERF_STAGE_COUNT
+} PerfStage;
+
+// Totals at one point in the run. Reports are the difference between two of these.
+typedef struct {
+    int64_t time_ns;
+    uint64_t sampleCount;
+    unsigned long windowCount;
+    int64_t stageTimes_ns[PERF_STAGE_COUNT];
+
+    // Output queue depth, summed over every window so it can be averaged
+    uint64_t queueDepthTotal;
+} PerfSnapshot;
+
+typedef struct {
+    double reportInterval_s;
+    FILE* jsonFile;
+
+    double sampleFrequency_Hz;
+    uint64_t totalSampleCount;
+    int queueCapacity;
+
+    int64_t stageStartTime_ns;
+    int intervalMaxQueueDepth;
+    int maxQueueDepth;
+
+    PerfSnapshot start;
+    PerfSnapshot current;
+    PerfSnapshot lastReport;
+} PerfCounters;
+
+// Options chosen at run time (see main.c)
+typedef struct {
+    double reportInterval_s;
+    FILE* jsonFile;
+} PerfReportOptions;
+
+int64_t perfTime_ns(void);
+void initPerfCounters(PerfCounters* counters, const PerfReportOptions* options, double sampleFrequency_Hz, uint64_t totalSampleCount, int queueCapacity);
+void perfStageBegin(PerfCounters* counters);
+void perfStageEnd(PerfCounters* counters, PerfStage stage);
+void perfWindowDone(PerfCounters* counters, int sampleCount, int queueDepth, int64_t outputTime_ns);
+void perfFinish(PerfCounters* counters, int64_t outputTime_ns);
+void reportPerfCounters(PerfCounters* counters, bool final);
+
+#endif
@@ -0,0 +1,22 @@
+#ifndef H_PIPELINE
+#define H_PIPELINE
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "formats.h"
+
+typedef struct OutputPipeline OutputPipeline;
+
+OutputPipeline* outputPipelineCreate(OutputCallback dumpCallback, int bufferCount, int bufferLength, const OutputFormat* format);
+short* outputPipelineAcquire(OutputPipeline* pipeline);
+void outputPipelineSubmit(OutputPipeline* pipeline, int length, gtime_t time);
+int outputPipelineDepth(OutputPipeline* pipeline);
+int64_t outputPipelineOutputTime_ns(OutputPipeline* pipeline);
+bool outputPipelineStopped(OutputPipeline* pipeline);
+void outputPipelineFlush(OutputPipeline* pipeline);
+void outputPipelineDestroy(OutputPipeline* pipeline);
+void outputBufferRetain(void* buffer);
+void outputBufferRelease(void* buffer);
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef H_SCENARIO
+#define H_SCENARIO
+
+#include <stdint.h>
+
+// Defaults for each scenario value (see scenario.c for how they can be changed at run time)
+#define DEFAULT_VISIBILITY_UPDATE_INTERVAL_S    (5.0 * 60.0)
+#define DEFAULT_SAMPLE_FREQUENCY_MSPS           (4.0)
+#define DEFAULT_SAMPLE_DURATION_S               (45.0)
+#define DEFAULT_IQ_SAMPLE_WINDOW_S              (0.1)
+#define DEFAULT_CHANNEL_COUNT                   (12)
+#define DEFAULT_SIGNAL_POWER_MODEL              (SIGNAL_POWER_MODEL_FIXED)
+#define DEFAULT_SIGNAL_POWER_RANGE_DB           (10.0)
+#define DEFAULT_NOISE_CN0_DBHZ                  (0.0)
+#define DEFAULT_NOISE_SEED                      (1)
+
+// Can't have more channels than there are GPS SVs to put in them
+#define SCENARIO_MAX_CHANNEL_COUNT              (32)
+
+// How each channel's signal power is chosen
+// NOTES:
+// 1. FIXED puts every channel at the trig table's full amplitude. This is the original behaviour and skips the gain multiply entirely.
+// 2. ELEVATION scales each channel from full amplitude at zenith down to SIGNAL_POWER_RANGE_DB weaker at the horizon,
+//    following the sine of the SV's elevation (see channelGain())
+enum {
+    SIGNAL_POWER_MODEL_FIXED,
+    SIGNAL_POWER_MODEL_ELEVATION
+};
+
+// Noise added to the output after the channels are mixed
+// NOTES:
+// 1. NOISE_CN0_DBHZ sets the noise floor as the C/N0 a channel at full amplitude would see against it. 0 turns the noise off.
+// 2. The noise is the same on every run with the same NOISE_SEED, whatever the window length or thread count (see noise.c)
+// 3. The default output format scales are picked for a noise-free signal, so quantised formats will want a smaller scale
+
+// What is being simulated, and at what rate
+// NOTE: The last three values are worked out from the others by finaliseScenario()
+typedef struct {
+    double visibilityUpdateInterval_s;
+    double sampleFrequency_MSPS;
+    double sampleDuration_s;
+    double iqSampleWindow_s;
+    int channelCount;
+    int signalPowerModel;
+    double signalPowerRange_dB;
+    double noiseCN0_dBHz;
+    int noiseSeed;
+
+    double sampleInterval_s;
+    uint64_t sampleRate_Hz;
+    int windowSampleCount;
+} ScenarioConfig;
+
+// The scenario the simulator is running. Set up by main() before simulate() is called.
+extern ScenarioConfig Scenario;
+
+void defaultScenario(ScenarioConfig* scenario);
+int setScenarioValue(ScenarioConfig* scenario, const char* name, const char* value);
+int loadScenarioFile(const char* filename, ScenarioConfig* scenario);
+int finaliseScenario(ScenarioConfig* scenario);
+
+#endif
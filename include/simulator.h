@@ -2,14 +2,20 @@
 #define H_SIMULATOR
 
 #include <stdbool.h>
+#include <stdint.h>
+
+#include "formats.h"
+#include "scenario.h"
+#include "perfcounters.h"
 
 // *** SIMULATION CONFIGURATION VALUES ****
-#define VISIBILITY_UPDATE_INTERVAL_S    (5.0 * 60.0)
-#define SAMPLE_FREQUENCY_MSPS           (4.0)
-#define SAMPLE_DURATION_S               (45.0)
-#define IQ_SAMPLE_WINDOW_S              (0.1)
-#define CHANNEL_COUNT			        (12)
-#define CARRIER_PHASE_RESOLUTION_INDEX  (12)
+// NOTES:
+// 1. Sample rate, duration, window size, channel count and visibility update interval are set at run time (see scenario.h)
+// 2. The carrier trig table's resolution, amplitude and interpolation are set when building (see src/makefile)
+// 3. The kernel can also be picked when building, e.g. "make SYNTHESIS_KERNEL=TABLE" (see synthesis.h for the choices)
+#ifndef SYNTHESIS_KERNEL
+#define SYNTHESIS_KERNEL                (SYNTHESIS_KERNEL_NCO)
+#endif
 /// *** END ***
 
 #define LIGHTSPEED              (2.99792458e8)
@@ -43,24 +49,63 @@
 #define CARRIER_WAVELENGTH_M        (LIGHTSPEED / CARRIER_FREQUENCY_HZ)
 #define CA_CODE_WAVELENGTH_M        (LIGHTSPEED / CA_CODE_FREQUENCY_HZ)
 #define CA_CODE_CHIP_DURATION_S     (1.0 / CA_CODE_FREQUENCY_HZ)
-#define FRAME_BIT_COUNT             (SUBFRAME_COUNT * WORD_COUNT * WORD_BIT_COUNT)
+#define SUBFRAME_BIT_COUNT          (WORD_COUNT * WORD_BIT_COUNT)
+#define FRAME_BIT_COUNT             (SUBFRAME_COUNT * SUBFRAME_BIT_COUNT)
 #define FRAME_CA_CHIP_COUNT         (FRAME_BIT_COUNT * CA_CYCLES_PER_NAV_BIT * CA_CODE_SEQUENCE_LENGTH)
-#define SAMPLE_INTERVAL_S       (1.0 / (SAMPLE_FREQUENCY_MSPS * 1000000.0))
-#define TRIG_TABLE_SIZE         (1 << CARRIER_PHASE_RESOLUTION_INDEX)
+
+// Fixed-point NCO formats
+// NOTES:
+// 1. The carrier NCO spans one cycle over the full 64 bits, so phase wraparound is free and the top bits index the trig table directly.
+//    The table's size is set at build time (see trig-tables.h), so NCO_CARRIER_INDEX_SHIFT is only usable alongside it.
+// 2. The code NCO holds chips into the current navbit with NCO_CODE_FRACTION_BITS of fractional chip
+#define NCO_CARRIER_SCALE       (18446744073709551616.0)
+#define NCO_CARRIER_INDEX_SHIFT (64 - TRIG_TABLE_INDEX_BITS)
+#define NCO_CODE_FRACTION_BITS  (48)
+#define NCO_CODE_SCALE          ((double)(1ULL << NCO_CODE_FRACTION_BITS))
+
+// How often each SV's pseudorange model is refitted (see updateSatellitePositions())
+// NOTES:
+// 1. Each SV is refitted as far ahead as its pseudorange jerk allows while keeping the model within
+//    GEOMETRY_ERROR_BUDGET_CYCLES of carrier phase, in whole windows, up to GEOMETRY_UPDATE_MAX_INTERVAL_S.
+// 2. The interval can grow by at most GEOMETRY_UPDATE_MAX_GROWTH times per update, so one low jerk estimate can't jump it straight to the maximum.
+#define GEOMETRY_ERROR_BUDGET_CYCLES    (0.01)
+#define GEOMETRY_UPDATE_MAX_INTERVAL_S  (10.0)
+#define GEOMETRY_UPDATE_MAX_GROWTH      (2.0)
+
+// Channel gains are fixed-point with CHANNEL_GAIN_FRACTION_BITS of fraction, so CHANNEL_GAIN_UNITY is full amplitude
+// NOTE: Gains never go above unity, which keeps 32 channels at the largest trig table amplitude within a 32-bit accumulator
+#define CHANNEL_GAIN_FRACTION_BITS  (8)
+#define CHANNEL_GAIN_UNITY          (1 << CHANNEL_GAIN_FRACTION_BITS)
 
 // For generating bitmasks
 #define BITMASK(bits) ((1 << (bits)) - 1)
 
-// Buffer size multiplied by two as we need to record both and I and a Q value per sample
-#define IQ_BUFFER_SIZE          (int)((SAMPLE_FREQUENCY_MSPS * 1000000 * IQ_SAMPLE_WINDOW_S) * 2)
+// Packed bit arrays hold one bit per chip or navbit, least significant bit first (see packedBit())
+#define PACKED_CA_CODE_WORD_COUNT   ((CA_CODE_SEQUENCE_LENGTH + 63) / 64)
+#define PACKED_FRAME_WORD_COUNT     ((FRAME_BIT_COUNT + 63) / 64)
 
 typedef struct {
-    char caCodeSequence[CA_CODE_SEQUENCE_LENGTH];
+    // PACKED_CA_CODE_WORD_COUNT words of packed chips, in the read-only tables generated at build time (see caCodeSequence())
+    const uint64_t* caCode;
+
+    // The code above sampled at the output sample rate (see codetables.h). Only built for the TABLE kernel
+    uint8_t* codeTable;
+
     unsigned long navFrameBoilerPlate[SUBFRAME_COUNT][WORD_COUNT];
-    unsigned long navFrame[SUBFRAME_COUNT][WORD_COUNT];
+
+    // navFrameBoilerPlate with parity, for the ephemeris with IODE navSubframesIode and subframe 1 holding WN navSubframesWn (see navmessage.c)
+    unsigned long navSubframes[SUBFRAME_COUNT][WORD_COUNT];
+    int navSubframesIode;
+    unsigned long navSubframesWn;
+
+    // The NAV frame being transmitted as one stream of bits in transmission order. Filled one subframe at a time (see generateNAVSubframe())
+    uint64_t navBitStream[PACKED_FRAME_WORD_COUNT];
 
 	unsigned short prn;
 
+    // Where this SV's ephemeris is in the orbit batch (see orbits.h)
+    int orbitIndex;
+
     eph_t ephemeris;
     
     double clockBias_s;
@@ -68,9 +113,20 @@ typedef struct {
 
     double position_ecef[3];
 
+    // Pseudorange model: psuedorange_m + (psuedorangeRate_ms * t) + (0.5 * psuedorangeAcceleration_mss * t^2), t seconds after psuedorangeFitTime
     double psuedorange_m;
     double psuedorangeRate_ms;
+    double psuedorangeAcceleration_mss;
+    gtime_t psuedorangeFitTime;
     double elevation_rad;
+
+    // Pseudoranges the model is fitted to, the time between each, and the time of the last one (when the next fit is due)
+    double psuedorangeSamples_m[3];
+    double psuedorangeSampleSpacing_s[2];
+    gtime_t psuedorangeSampleTime;
+
+    // How quickly the model's acceleration has been changing. Negative until there have been two fits.
+    double psuedorangeJerk_msss;
 } SV;
 
 typedef struct {
@@ -82,15 +138,58 @@ typedef struct {
     double carrierPhase_cycles;
     double codeFrequency_Hz;
 
-    unsigned long previousWord;
+    // TOW count and WN at the start of the NAV frame being transmitted (see startNAVFrame())
+    unsigned long navFrameTow_epochs;
+    int navFrameWn;
 
     char codeChip;
     char navBit;
 
     double codeChipPointer;
     int navBitPointer;
+
+    // Fixed-point equivalents of the above used by the NCO kernel (see NCO formats)
+    uint64_t carrierPhase_nco;
+    uint64_t carrierRate_nco;
+    uint64_t codePhase_nco;
+    uint64_t codeRate_nco;
+
+    // Change in the NCO rates per sample (carrier) and per synthesis block (code), following the SV's pseudorange model
+    int64_t carrierRateStep_nco;
+    int64_t codeRateStep_nco;
+
+    // Amplitude the channel is mixed at (see CHANNEL_GAIN_FRACTION_BITS). Only used by the NCO and TABLE kernels.
+    int32_t gain;
 } Channel;
 
-void simulate(void (*dumpCallback)(short*, int), eph_t* ephemerides, short svCount);
+// Receives each window of output: size bytes of IQ data in the output format, holding sampleCount samples starting at time
+// NOTE: Returning anything but 0 stops the simulation at the end of the window being synthesised
+typedef int (*OutputCallback)(void* data, int size, int sampleCount, gtime_t time);
+
+// Options chosen at run time (see main.c)
+typedef struct {
+    int threadCount;
+    int outputBufferCount;
+    OutputFormat outputFormat;
+
+    // Channel mixer and noise generator to use instead of the widest ones the CPU supports. NULL for the widest.
+    const char* mixerName;
+    const char* noiseGeneratorName;
+    PerfReportOptions perfReport;
+} SimulationOptions;
+
+// Read one bit from a packed bit array
+static inline char packedBit(const uint64_t* bits, int index) {
+    return (char)((bits[index >> 6] >> (index & 63)) & 0x1);
+}
+
+gtime_t sampleTime(gtime_t epoch, uint64_t sampleIndex);
+uint64_t secondsToSamples(double duration_s);
+const uint64_t* caCodeSequence(int prn);
+void generateNAVFrameBoilerplate(unsigned long frame[SUBFRAME_COUNT][WORD_COUNT], eph_t* ephemeris);
+void advanceChannelModulation(Channel* channel, gtime_t simulationTime, double totalIncrement_s, bool init);
+double psuedorangeAt(const SV* sv, gtime_t time, double* psuedorangeRate_ms);
+void updateChannelProperties(gtime_t simulationTime, Channel* channels, int channelCount);
+int simulate(OutputCallback dumpCallback, eph_t* ephemerides, short svCount, SimulationOptions* options);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,30 @@
+#ifndef H_SYNTHESIS
+#define H_SYNTHESIS
+
+// Number of samples mixed per pass of the block kernel. Every channel is summed into one block before
+// moving onto the next so the block's slice of the IQ buffer stays in cache.
+#define SYNTHESIS_BLOCK_SAMPLE_COUNT    (4096)
+
+// Kernels available for filling an IQ window (selected with SYNTHESIS_KERNEL)
+// NOTES:
+// 1. REFERENCE advances every channel one sample at a time with advanceChannelModulation(). Slow, but it's the original behaviour
+// 2. BLOCK gives bit-identical output to REFERENCE, just much faster
+// 3. NCO uses fixed-point phase accumulators and the vectorised channel mixer. Output closely matches REFERENCE but is not bit-identical
+// 4. TABLE is NCO with the code read from per-SV tables sampled at the output rate (see codetables.h). Code transitions
+//    may land up to half a phase offset away from where NCO puts them, in exchange for far less work per sample
+enum {
+    SYNTHESIS_KERNEL_REFERENCE,
+    SYNTHESIS_KERNEL_BLOCK,
+    SYNTHESIS_KERNEL_NCO,
+    SYNTHESIS_KERNEL_TABLE
+};
+
+void loadChannelNCO(Channel* channel);
+void synthesizeChannelBlock(Channel* channel, gtime_t epoch, uint64_t blockStartSample, short* iqBuffer, int sampleCount);
+void synthesizeChannelBlockNCO(Channel* channel, gtime_t epoch, uint64_t blockStartSample, int32_t* iAccumulator, int32_t* qAccumulator, int32_t* signMask, int sampleCount);
+void initSynthesis(int threadCount, int maxSampleCount, const char* mixerName, const char* noiseGeneratorName);
+void freeSynthesis(void);
+int synthesizeWindow(gtime_t epoch, uint64_t windowStartSample, Channel* channels, int channelCount, short* iqBuffer, int sampleCount);
+void synthesizeWindowReference(gtime_t epoch, uint64_t windowStartSample, Channel* channels, int channelCount, short* iqBuffer, int sampleCount);
+
+#endif
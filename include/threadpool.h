@@ -0,0 +1,14 @@
+#ifndef H_THREADPOOL
+#define H_THREADPOOL
+
+// Work run by every thread in the pool. "worker" runs from 0 to (workerCount - 1).
+typedef void (*ThreadPoolTask)(void* context, int worker, int workerCount);
+
+typedef struct ThreadPool ThreadPool;
+
+ThreadPool* threadPoolCreate(int threadCount);
+int threadPoolSize(ThreadPool* pool);
+void threadPoolRun(ThreadPool* pool, ThreadPoolTask task, void* context);
+void threadPoolDestroy(ThreadPool* pool);
+
+#endif
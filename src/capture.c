@@ -0,0 +1,186 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "../libs/rtklib-2.4.3/src/rtklib.h"
+
+#include "../include/simulator.h"
+#include "../include/capture.h"
+#include "../include/filewriter.h"
+
+// Splits a capture over as many files as it takes, each with an index of where it is in GPS time.
+// NOTES:
+// 1. Files are only ever split between windows. A new file is started when the next window would take the current
+//    one past maxFileBytes, or once it holds maxFileDuration_s of samples.
+// 2. When splitting, files are numbered by inserting "_0000", "_0001"... before the filename's extension.
+// 3. Each file gets a "<file>.index" text file listing sample offsets (and the matching byte offsets) against GPS
+//    week and TOW, one line every CAPTURE_INDEX_INTERVAL_S. Any sample's time can be worked out from the nearest
+//    line, so tools can start reading part way through a file.
+// 4. Space for each file is reserved up front (see filewriter.c) based on how big the file is expected to end up.
+
+#define CAPTURE_FILENAME_LENGTH     (1024)
+
+struct CaptureSink {
+    CaptureOptions options;
+    bool splitting;
+
+    int fileNumber;
+    FileWriter* writer;
+    FILE* index;
+
+    long long fileBytes;
+    long long fileSamples;
+    long long totalSamples;
+    long long nextIndexSample;
+
+    bool failed;
+};
+
+// Build the name of file number "fileNumber"
+static void captureFilename(CaptureSink* capture, char* filename, int fileNumber) {
+    const char* base = capture->options.filename;
+
+    if (!capture->splitting) {
+        snprintf(filename, CAPTURE_FILENAME_LENGTH, "%s", base);
+        return;
+    }
+
+    // Only treat a dot after the last slash as the start of an extension
+    const char* extension = strrchr(base, '.');
+    const char* directory = strrchr(base, '/');
+
+    if (!extension || (directory && (extension < directory))) {
+        extension = base + strlen(base);
+    }
+
+    snprintf(filename, CAPTURE_FILENAME_LENGTH, "%.*s_%04i%s", (int)(extension - base), base, fileNumber, extension);
+}
+
+// How many bytes the next file should end up holding, so the space can be reserved
+static long long expectedFileBytes(CaptureSink* capture, int windowSize, int windowSampleCount) {
+    long long remainingSamples = (long long)secondsToSamples(Scenario.sampleDuration_s) - capture->totalSamples;
+    long long fileSamples = remainingSamples;
+
+    if ((capture->options.maxFileDuration_s > 0) && ((long long)secondsToSamples(capture->options.maxFileDuration_s) < fileSamples)) {
+        fileSamples = (long long)secondsToSamples(capture->options.maxFileDuration_s);
+    }
+
+    long long windowCount = (fileSamples + (windowSampleCount - 1)) / windowSampleCount;
+    long long fileBytes = windowCount * windowSize;
+
+    if ((capture->options.maxFileBytes > 0) && (capture->options.maxFileBytes < fileBytes)) {
+        fileBytes = capture->options.maxFileBytes;
+    }
+
+    return fileBytes;
+}
+
+static int closeCaptureFile(CaptureSink* capture) {
+    int result = 0;
+
+    if (capture->writer) {
+        result = fileWriterClose(capture->writer);
+        capture->writer = NULL;
+    }
+
+    if (capture->index) {
+        fclose(capture->index);
+        capture->index = NULL;
+    }
+
+    return result;
+}
+
+static int openCaptureFile(CaptureSink* capture, int windowSize, int windowSampleCount) {
+    char filename[CAPTURE_FILENAME_LENGTH];
+    char indexFilename[CAPTURE_FILENAME_LENGTH + 8];
+
+    captureFilename(capture, filename, capture->fileNumber);
+    snprintf(indexFilename, sizeof(indexFilename), "%s.index", filename);
+
+    capture->writer = fileWriterOpen(filename, capture->options.directWrites, capture->options.writeDepth, expectedFileBytes(capture, windowSize, windowSampleCount));
+    capture->index = fopen(indexFilename, "w");
+
+    if (!capture->writer || !capture->index) {
+        printf("Error: Could not open capture file %s\n", filename);
+        return -1;
+    }
+
+    fprintf(capture->index, "# sample_offset byte_offset gps_week gps_tow_s\n");
+
+    capture->fileNumber++;
+    capture->fileBytes = 0;
+    capture->fileSamples = 0;
+    capture->nextIndexSample = 0;
+
+    return 0;
+}
+
+CaptureSink* captureOpen(const CaptureOptions* options) {
+    CaptureSink* capture = (CaptureSink*)calloc(1, sizeof(CaptureSink));
+
+    capture->options = *options;
+    capture->splitting = (options->maxFileBytes > 0) || (options->maxFileDuration_s > 0);
+
+    // Files are opened when the first window arrives, once its size is known
+    return capture;
+}
+
+// Write a window of output (see OutputCallback), starting a new file first if need be
+int captureWrite(CaptureSink* capture, void* data, int size, int sampleCount, gtime_t time) {
+    if (capture->failed) {
+        return -1;
+    }
+
+    if (capture->writer) {
+        bool full = (capture->options.maxFileBytes > 0) && ((capture->fileBytes + size) > capture->options.maxFileBytes);
+        bool long_enough = (capture->options.maxFileDuration_s > 0) && (capture->fileSamples >= (long long)secondsToSamples(capture->options.maxFileDuration_s));
+
+        // Never leave a file empty, even if one window is bigger than the limit
+        if ((full || long_enough) && (capture->fileBytes > 0)) {
+            if (closeCaptureFile(capture) != 0) {
+                capture->failed = true;
+                return -1;
+            }
+        }
+    }
+
+    if (!capture->writer && (openCaptureFile(capture, size, sampleCount) != 0)) {
+        capture->failed = true;
+        return -1;
+    }
+
+    // Index every CAPTURE_INDEX_INTERVAL_S, working out the time of the exact sample from the window's start time
+    while (capture->nextIndexSample < (capture->fileSamples + sampleCount)) {
+        long long windowOffset = (capture->nextIndexSample - capture->fileSamples);
+        long long byteOffset = capture->fileBytes + ((windowOffset * size) / sampleCount);
+
+        int week;
+        double tow_s = time2gpst(timeadd(time, (windowOffset * Scenario.sampleInterval_s)), &week);
+
+        fprintf(capture->index, "%lld %lld %i %.9f\n", capture->nextIndexSample, byteOffset, week, tow_s);
+
+        capture->nextIndexSample += (long long)secondsToSamples(CAPTURE_INDEX_INTERVAL_S);
+    }
+
+    if (fileWriterWrite(capture->writer, data, size) != 0) {
+        capture->failed = true;
+        return -1;
+    }
+
+    capture->fileBytes += size;
+    capture->fileSamples += sampleCount;
+    capture->totalSamples += sampleCount;
+
+    return 0;
+}
+
+// Finish the current file. Returns -1 if anything went wrong during the capture.
+int captureClose(CaptureSink* capture) {
+    int result = (closeCaptureFile(capture) != 0) || capture->failed ? -1 : 0;
+
+    free(capture);
+
+    return result;
+}
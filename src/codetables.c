@@ -0,0 +1,111 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "../libs/rtklib-2.4.3/src/rtklib.h"
+
+#include "../include/simulator.h"
+#include "../include/codetables.h"
+
+// NOTES:
+// 1. Each table is one SV's code sampled at one of the Doppler bin's code rates, starting a fraction of a sample into the
+//    code. A run of samples is then just a contiguous read starting at the sample nearest the channel's code phase.
+// 2. The exact code phase still comes from the channel's code NCO (see synthesis.c). Tables are only read for one run at
+//    a time, so the bin's rate being slightly off never has time to build up into a code phase error.
+// 3. Table entries are stored as 0/1 chips, one per byte. Each table covers one code period plus the longest run.
+// 4. All rates and phases use the code NCO's fixed-point format (see NCO formats)
+
+static uint8_t* Tables;
+static uint64_t BinRates[CODE_TABLE_DOPPLER_BIN_COUNT];
+static int PhaseOffsetCount;
+static int TableLength;
+
+static inline const uint8_t* codeTable(const SV* sv, int bin, int phaseOffset) {
+    return &sv->codeTable[(long)((bin * PhaseOffsetCount) + phaseOffset) * TableLength];
+}
+
+// Build the code tables for every SV
+void initCodeTables(SV* svs, int svCount) {
+    uint64_t codePeriod = ((uint64_t)CA_CODE_SEQUENCE_LENGTH << NCO_CODE_FRACTION_BITS);
+
+    // Code rate in chips per sample at the centre of each bin
+    for (int bin = 0; bin < CODE_TABLE_DOPPLER_BIN_COUNT; bin++) {
+        double binDoppler_Hz = (((bin + 0.5) / CODE_TABLE_DOPPLER_BIN_COUNT) * (2 * CODE_TABLE_DOPPLER_SPAN_HZ)) - CODE_TABLE_DOPPLER_SPAN_HZ;
+        BinRates[bin] = (uint64_t)llround((CA_CODE_FREQUENCY_HZ + binDoppler_Hz) * Scenario.sampleInterval_s * NCO_CODE_SCALE);
+    }
+
+    // The slowest bin takes the most samples to cover a code period
+    TableLength = (int)(codePeriod / BinRates[0]) + CODE_TABLE_MAX_RUN_SAMPLE_COUNT + 1;
+
+    // Use as many phase offsets as the cache budget allows for the active channels
+    PhaseOffsetCount = CODE_TABLE_CACHE_BYTES / (Scenario.channelCount * CODE_TABLE_DOPPLER_BIN_COUNT * TableLength);
+
+    if (PhaseOffsetCount < 1) {
+        PhaseOffsetCount = 1;
+    }
+
+    else if (PhaseOffsetCount > CODE_TABLE_MAX_PHASE_OFFSET_COUNT) {
+        PhaseOffsetCount = CODE_TABLE_MAX_PHASE_OFFSET_COUNT;
+    }
+
+    long svTableSize = ((long)CODE_TABLE_DOPPLER_BIN_COUNT * PhaseOffsetCount * TableLength);
+    Tables = (uint8_t*)malloc(svCount * svTableSize);
+
+    for (int i = 0; i < svCount; i++) {
+        svs[i].codeTable = &Tables[i * svTableSize];
+
+        for (int bin = 0; bin < CODE_TABLE_DOPPLER_BIN_COUNT; bin++) {
+            for (int phaseOffset = 0; phaseOffset < PhaseOffsetCount; phaseOffset++) {
+                uint8_t* table = (uint8_t*)codeTable(&svs[i], bin, phaseOffset);
+
+                // Sample from the middle of the slice of a sample this offset stands for
+                uint64_t codePhase = ((((2 * phaseOffset) + 1) * BinRates[bin]) / (2 * PhaseOffsetCount));
+
+                for (int sample = 0; sample < TableLength; sample++, codePhase += BinRates[bin]) {
+                    table[sample] = (uint8_t)packedBit(svs[i].caCode, (int)((codePhase >> NCO_CODE_FRACTION_BITS) % CA_CODE_SEQUENCE_LENGTH));
+                }
+            }
+        }
+    }
+
+    printf("CODE TABLES: %i DOPPLER BINS x %i PHASE OFFSETS (%li KB PER CHANNEL)\n", CODE_TABLE_DOPPLER_BIN_COUNT, PhaseOffsetCount, (svTableSize / 1024));
+}
+
+void freeCodeTables(void) {
+    free(Tables);
+    Tables = NULL;
+}
+
+// Fill signMask (see mixer.h) with the SV's code XORed with navBit, starting at codePhase and advancing codeRate chips per sample.
+// NOTES:
+// 1. sampleCount must be no more than CODE_TABLE_MAX_RUN_SAMPLE_COUNT
+// 2. codePhase can be any number of chips. Only its position within the code period matters.
+// 3. The code phase is rounded to the nearest phase offset, i.e. to within 1 / (2 * PhaseOffsetCount) of a sample.
+void generateCodeTableSignMask(const SV* sv, uint64_t codePhase, uint64_t codeRate, char navBit, int32_t* signMask, int sampleCount) {
+    uint64_t codePeriod = ((uint64_t)CA_CODE_SEQUENCE_LENGTH << NCO_CODE_FRACTION_BITS);
+
+    // Pick the bin closest to the channel's code rate
+    int bin = 0;
+
+    for (int candidate = 1; candidate < CODE_TABLE_DOPPLER_BIN_COUNT; candidate++) {
+        uint64_t candidateError = (BinRates[candidate] > codeRate) ? (BinRates[candidate] - codeRate) : (codeRate - BinRates[candidate]);
+        uint64_t binError = (BinRates[bin] > codeRate) ? (BinRates[bin] - codeRate) : (codeRate - BinRates[bin]);
+
+        if (candidateError < binError) {
+            bin = candidate;
+        }
+    }
+
+    // Find the table sample at or just before the code phase, and how far into that sample the code phase is
+    uint64_t phase = (codePhase % codePeriod);
+    uint64_t start = (phase / BinRates[bin]);
+    uint64_t residual = (phase - (start * BinRates[bin]));
+    int phaseOffset = (int)((residual * PhaseOffsetCount) / BinRates[bin]);
+
+    const uint8_t* chips = &codeTable(sv, bin, phaseOffset)[start];
+
+    for (int i = 0; i < sampleCount; i++) {
+        signMask[i] = -(int32_t)(chips[i] ^ navBit);
+    }
+}
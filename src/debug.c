@@ -102,6 +102,10 @@ void dumpChannels(gtime_t newSimulationTime, Channel* channels, int channelCount
 
     // Dump the data!
     for (int i = 0; i < channelCount; i++) {
+        // The SV's pseudorange model may have been fitted a while ago, so evaluate it now
+        double psuedorangeRate_ms;
+        double psuedorange_m = psuedorangeAt(channels[i].sv, newSimulationTime, &psuedorangeRate_ms);
+
         fprintf(dump_file,
             "%.3f\t\
             %i\t\
@@ -114,14 +118,14 @@ void dumpChannels(gtime_t newSimulationTime, Channel* channels, int channelCount
             %.2f\t\
             %.2f\t\
             %.2f\t\
-            %.2f\t\
+            %.6f\t\
             %i\t\
-            %.2f\n",
+            %.6f\n",
 
             simulationTime,
             channels[i].sv->prn,
-            channels[i].sv->psuedorange_m,
-            channels[i].sv->psuedorangeRate_ms,
+            psuedorange_m,
+            psuedorangeRate_ms,
             channels[i].sv->position_ecef[0],
             channels[i].sv->position_ecef[1],
             channels[i].sv->position_ecef[2],
@@ -0,0 +1,432 @@
+// Needed for O_DIRECT, pwrite() and posix_memalign() under -std=c99
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#ifdef HAVE_LIBURING
+#include <liburing.h>
+#endif
+
+#include "../include/filewriter.h"
+
+// Writes IQ data to a file without the output thread ever waiting on the disk (unless every chunk is still in flight).
+// NOTES:
+// 1. Data is copied into a ring of page-aligned chunks. Full chunks are written asynchronously, up to "depth" at a time,
+//    while the next chunk is filled. Copying costs far less than the writes and keeps every write large and aligned,
+//    which is what O_DIRECT needs and what NVMe drives like.
+// 2. Chunks are written with io_uring when the simulator is built against liburing ("make USE_LIBURING=1") and the
+//    kernel allows it. Otherwise they're written with pwrite() by a pool of threads, one per write in flight. Each
+//    thread writes a whole chunk at its own offset, so the writes can finish in any order.
+// 3. With O_DIRECT the last chunk is padded out to the alignment and the file is truncated back afterwards.
+// 4. Space can be reserved up front with fallocate() so a long capture's extents are allocated in one go rather than
+//    a chunk at a time. The file is truncated back to what was actually written when it's closed.
+// 5. If io_uring itself stops working (rather than a write failing) the ring is abandoned. The capture is marked as
+//    failed, every chunk is treated as done so nothing waits on a completion that will never come, and later
+//    chunks are dropped.
+
+enum {
+    FILE_WRITER_PWRITE,
+    FILE_WRITER_IO_URING
+};
+
+typedef struct {
+    unsigned char* data;
+    int size;
+    off_t offset;
+    bool inFlight;
+} FileWriterChunk;
+
+struct FileWriter {
+    int fd;
+    bool direct;
+    bool preallocated;
+    int backend;
+    bool failed;
+    bool ringAbandoned;
+
+    FileWriterChunk* chunks;
+    int chunkCount;
+    int currentChunk;
+    off_t nextOffset;
+
+#ifdef HAVE_LIBURING
+    struct io_uring ring;
+#endif
+
+    // pwrite() backend. Chunks are submitted and claimed by the threads in ring order. A chunk isn't refilled until
+    // its write has finished, so no two threads ever write the same chunk.
+    pthread_t* threads;
+    int threadCount;
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+    unsigned long submittedCount;
+    unsigned long claimedCount;
+    bool stopping;
+};
+
+// NOTE: May be called from the writer thread, so "failed" is only touched atomically
+static void reportWriteError(FileWriter* writer, int error) {
+    if (!__atomic_exchange_n(&writer->failed, true, __ATOMIC_RELAXED)) {
+        printf("Error: Could not write to capture file (%s)\n", strerror(error));
+    }
+}
+
+static bool writeFailed(FileWriter* writer) {
+    return __atomic_load_n(&writer->failed, __ATOMIC_RELAXED);
+}
+
+// Write a whole chunk, carrying on after any partial writes
+static int writeChunk(int fd, FileWriterChunk* chunk) {
+    int written = 0;
+
+    while (written < chunk->size) {
+        ssize_t result = pwrite(fd, (chunk->data + written), (chunk->size - written), (chunk->offset + written));
+
+        if (result < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            return errno;
+        }
+
+        written += (int)result;
+    }
+
+    return 0;
+}
+
+static void* writerThreadMain(void* argument) {
+    FileWriter* writer = (FileWriter*)argument;
+
+    pthread_mutex_lock(&writer->lock);
+
+    while (true) {
+        while ((writer->claimedCount == writer->submittedCount) && !writer->stopping) {
+            pthread_cond_wait(&writer->changed, &writer->lock);
+        }
+
+        if (writer->claimedCount == writer->submittedCount) {
+            break;
+        }
+
+        FileWriterChunk* chunk = &writer->chunks[writer->claimedCount % writer->chunkCount];
+        writer->claimedCount++;
+
+        // Write without holding the lock so the output thread can carry on filling chunks
+        pthread_mutex_unlock(&writer->lock);
+        int error = writeChunk(writer->fd, chunk);
+        pthread_mutex_lock(&writer->lock);
+
+        if (error != 0) {
+            reportWriteError(writer, error);
+        }
+
+        chunk->inFlight = false;
+
+        pthread_cond_broadcast(&writer->changed);
+    }
+
+    pthread_mutex_unlock(&writer->lock);
+
+    return NULL;
+}
+
+#ifdef HAVE_LIBURING
+// Give up on io_uring after it has failed (see note 5)
+static void abandonRing(FileWriter* writer, int error) {
+    reportWriteError(writer, error);
+    writer->ringAbandoned = true;
+
+    for (int i = 0; i < writer->chunkCount; i++) {
+        writer->chunks[i].inFlight = false;
+    }
+}
+
+// Collect one finished io_uring write. Returns without collecting anything if the wait is interrupted.
+static void reapCompletion(FileWriter* writer) {
+    struct io_uring_cqe* cqe;
+    int result = io_uring_wait_cqe(&writer->ring, &cqe);
+
+    if (result == -EINTR) {
+        return;
+    }
+
+    if (result < 0) {
+        abandonRing(writer, -result);
+        return;
+    }
+
+    FileWriterChunk* chunk = (FileWriterChunk*)io_uring_cqe_get_data(cqe);
+
+    if (cqe->res < 0) {
+        reportWriteError(writer, -cqe->res);
+    }
+
+    // Short writes to a regular file mean the disk is full
+    else if (cqe->res != chunk->size) {
+        reportWriteError(writer, ENOSPC);
+    }
+
+    chunk->inFlight = false;
+    io_uring_cqe_seen(&writer->ring, cqe);
+}
+#endif
+
+static void submitChunk(FileWriter* writer, FileWriterChunk* chunk) {
+    chunk->offset = writer->nextOffset;
+    chunk->inFlight = true;
+    writer->nextOffset += chunk->size;
+
+#ifdef HAVE_LIBURING
+    if (writer->backend == FILE_WRITER_IO_URING) {
+        if (writer->ringAbandoned) {
+            chunk->inFlight = false;
+            return;
+        }
+
+        struct io_uring_sqe* sqe = io_uring_get_sqe(&writer->ring);
+
+        // The ring has a slot for every chunk, so this shouldn't happen. If it does, write the chunk here and now.
+        if (!sqe) {
+            int error = writeChunk(writer->fd, chunk);
+
+            if (error != 0) {
+                reportWriteError(writer, error);
+            }
+
+            chunk->inFlight = false;
+            return;
+        }
+
+        io_uring_prep_write(sqe, writer->fd, chunk->data, chunk->size, chunk->offset);
+        io_uring_sqe_set_data(sqe, chunk);
+
+        int result;
+
+        do {
+            result = io_uring_submit(&writer->ring);
+        } while (result == -EINTR);
+
+        if (result < 0) {
+            abandonRing(writer, -result);
+        }
+
+        return;
+    }
+#endif
+
+    pthread_mutex_lock(&writer->lock);
+    writer->submittedCount++;
+    pthread_cond_broadcast(&writer->changed);
+    pthread_mutex_unlock(&writer->lock);
+}
+
+static void waitForChunk(FileWriter* writer, FileWriterChunk* chunk) {
+#ifdef HAVE_LIBURING
+    if (writer->backend == FILE_WRITER_IO_URING) {
+        while (chunk->inFlight) {
+            reapCompletion(writer);
+        }
+
+        return;
+    }
+#endif
+
+    pthread_mutex_lock(&writer->lock);
+
+    while (chunk->inFlight) {
+        pthread_cond_wait(&writer->changed, &writer->lock);
+    }
+
+    pthread_mutex_unlock(&writer->lock);
+}
+
+// Tell the pwrite() threads to finish once every submitted chunk is written and wait for them
+static void stopWriterThreads(FileWriter* writer) {
+    pthread_mutex_lock(&writer->lock);
+    writer->stopping = true;
+    pthread_cond_broadcast(&writer->changed);
+    pthread_mutex_unlock(&writer->lock);
+
+    for (int i = 0; i < writer->threadCount; i++) {
+        pthread_join(writer->threads[i], NULL);
+    }
+
+    pthread_mutex_destroy(&writer->lock);
+    pthread_cond_destroy(&writer->changed);
+}
+
+// Close the file and free the chunks. Chunks that were never allocated are NULL.
+static void freeFileWriter(FileWriter* writer) {
+    close(writer->fd);
+    free(writer->threads);
+
+    for (int i = 0; i < writer->chunkCount; i++) {
+        free(writer->chunks[i].data);
+    }
+
+    free(writer->chunks);
+    free(writer);
+}
+
+// Open filename for writing (truncating it). depth is the number of chunk writes allowed in flight.
+// NOTES:
+// 1. If O_DIRECT isn't supported by the file system the file is opened normally instead.
+// 2. preallocateBytes of space is reserved for the file if it's above 0 and the file system supports it.
+// 3. Returns NULL if the file can't be opened or the writer can't be set up.
+FileWriter* fileWriterOpen(const char* filename, bool direct, int depth, long long preallocateBytes) {
+    int flags = (O_WRONLY | O_CREAT | O_TRUNC);
+    int fd = open(filename, (direct ? (flags | O_DIRECT) : flags), 0644);
+
+    if ((fd < 0) && direct && (errno == EINVAL)) {
+        printf("Error: O_DIRECT not supported for capture file. Using buffered writes\n");
+
+        direct = false;
+        fd = open(filename, flags, 0644);
+    }
+
+    if (fd < 0) {
+        printf("Error: Could not open capture file (%s)\n", strerror(errno));
+        return NULL;
+    }
+
+    FileWriter* writer = (FileWriter*)calloc(1, sizeof(FileWriter));
+    writer->fd = fd;
+    writer->direct = direct;
+
+    // Not every file system can do this. Writing still works without it.
+    if ((preallocateBytes > 0) && (fallocate(fd, FALLOC_FL_KEEP_SIZE, 0, preallocateBytes) == 0)) {
+        writer->preallocated = true;
+    }
+
+    // One chunk is always being filled on top of the ones in flight
+    writer->chunkCount = ((depth < 1) ? 1 : depth) + 1;
+    writer->chunks = (FileWriterChunk*)calloc(writer->chunkCount, sizeof(FileWriterChunk));
+
+    for (int i = 0; i < writer->chunkCount; i++) {
+        if (posix_memalign((void**)&writer->chunks[i].data, FILE_WRITER_ALIGNMENT, FILE_WRITER_CHUNK_BYTES) != 0) {
+            printf("Error: Could not allocate capture file buffers\n");
+            freeFileWriter(writer);
+            return NULL;
+        }
+    }
+
+    writer->backend = FILE_WRITER_PWRITE;
+
+#ifdef HAVE_LIBURING
+    // Containers and older kernels often refuse io_uring
+    if (io_uring_queue_init(writer->chunkCount, &writer->ring, 0) == 0) {
+        writer->backend = FILE_WRITER_IO_URING;
+    }
+#endif
+
+    if (writer->backend == FILE_WRITER_PWRITE) {
+        pthread_mutex_init(&writer->lock, NULL);
+        pthread_cond_init(&writer->changed, NULL);
+
+        int threadCount = (writer->chunkCount - 1);
+        writer->threads = (pthread_t*)calloc(threadCount, sizeof(pthread_t));
+
+        for (int i = 0; i < threadCount; i++) {
+            if (pthread_create(&writer->threads[i], NULL, writerThreadMain, writer) != 0) {
+                printf("Error: Could not start capture file writer thread %i\n", i);
+                break;
+            }
+
+            writer->threadCount++;
+        }
+
+        // Carry on with the threads we did manage to start, as long as there's at least one
+        if (writer->threadCount == 0) {
+            stopWriterThreads(writer);
+            freeFileWriter(writer);
+            return NULL;
+        }
+    }
+
+    if (writer->backend == FILE_WRITER_IO_URING) {
+        printf("FILE WRITER: IO_URING (%i WRITES IN FLIGHT%s)\n", (writer->chunkCount - 1), (direct ? ", O_DIRECT" : ""));
+    }
+
+    else {
+        printf("FILE WRITER: PWRITE THREADS (%i WRITES IN FLIGHT%s)\n", writer->threadCount, (direct ? ", O_DIRECT" : ""));
+    }
+
+    return writer;
+}
+
+// Queue size bytes of data for writing. Returns -1 once any write has failed.
+int fileWriterWrite(FileWriter* writer, const void* data, int size) {
+    const unsigned char* bytes = (const unsigned char*)data;
+
+    while (size > 0) {
+        FileWriterChunk* chunk = &writer->chunks[writer->currentChunk];
+        int space = (FILE_WRITER_CHUNK_BYTES - chunk->size);
+        int copySize = (size < space) ? size : space;
+
+        memcpy((chunk->data + chunk->size), bytes, copySize);
+        chunk->size += copySize;
+        bytes += copySize;
+        size -= copySize;
+
+        // Send the chunk off once it's full and move onto the next, waiting for its last write if need be
+        if (chunk->size == FILE_WRITER_CHUNK_BYTES) {
+            submitChunk(writer, chunk);
+
+            writer->currentChunk = ((writer->currentChunk + 1) % writer->chunkCount);
+            waitForChunk(writer, &writer->chunks[writer->currentChunk]);
+            writer->chunks[writer->currentChunk].size = 0;
+        }
+    }
+
+    return writeFailed(writer) ? -1 : 0;
+}
+
+// Write out whatever is left, wait for every write to finish and close the file. Returns -1 if any write failed.
+int fileWriterClose(FileWriter* writer) {
+    FileWriterChunk* chunk = &writer->chunks[writer->currentChunk];
+    off_t fileSize = (writer->nextOffset + chunk->size);
+
+    if (chunk->size > 0) {
+        // O_DIRECT writes must be whole blocks. The padding is cut off again below.
+        if (writer->direct) {
+            int paddedSize = ((chunk->size + (FILE_WRITER_ALIGNMENT - 1)) / FILE_WRITER_ALIGNMENT) * FILE_WRITER_ALIGNMENT;
+
+            memset((chunk->data + chunk->size), 0, (paddedSize - chunk->size));
+            chunk->size = paddedSize;
+        }
+
+        submitChunk(writer, chunk);
+    }
+
+    for (int i = 0; i < writer->chunkCount; i++) {
+        waitForChunk(writer, &writer->chunks[i]);
+    }
+
+    if (writer->backend == FILE_WRITER_PWRITE) {
+        stopWriterThreads(writer);
+    }
+
+#ifdef HAVE_LIBURING
+    else {
+        io_uring_queue_exit(&writer->ring);
+    }
+#endif
+
+    // Drop the O_DIRECT padding and any preallocated space that wasn't used
+    if ((writer->direct || writer->preallocated) && (ftruncate(writer->fd, fileSize) != 0)) {
+        reportWriteError(writer, errno);
+    }
+
+    int result = writeFailed(writer) ? -1 : 0;
+    freeFileWriter(writer);
+
+    return result;
+}
@@ -0,0 +1,165 @@
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "../include/formats.h"
+#include "../include/trig-tables.h"
+
+// NOTES:
+// 1. Layouts (I and Q always interleaved, I first):
+//    INT16   - Two's complement shorts, as the simulator produces them
+//    INT8    - Two's complement bytes (GNSS-SDR "ibyte")
+//    INT4    - One byte per sample. I in the low nibble, Q in the high nibble, both two's complement
+//    INT2    - One byte per two samples. I0, Q0, I1, Q1 from the lowest bit pair up. Each value is one of the four
+//              levels -3, -1, +1, +3, stored offset binary as 0b00, 0b01, 0b10, 0b11 (level = 2 * code - 3)
+//    FLOAT32 - Native floats (GNSS-SDR "gr_complex")
+// 2. Conversion is done in place. Every format but FLOAT32 is no bigger than the shorts it's made from, so it can
+//    be written front to back. FLOAT32 is written back to front into a buffer twice the size.
+// 3. The default scales put the RMS of the summed channels (about 600 for 12 channels of amplitude 250) at
+//    roughly a quarter of the range for INT8 and INT4. For INT2 they put the threshold between the inner and outer
+//    levels at about the RMS, which is about where 2-bit quantisation loses least signal. They're given for
+//    amplitude 250 and follow the trig table's amplitude (see trig-tables.h) for the quantised formats.
+// 4. INT2 rounds to the nearest odd level, so its thresholds are at 0 and +/-2 once scaled. A clip level of 1 keeps
+//    only the inner levels (sign only) in the same layout.
+
+typedef struct {
+    const char* name;
+    int maxValue;
+    double defaultScale;
+} OutputFormatInfo;
+
+static const OutputFormatInfo FormatInfo[] = {
+    [OUTPUT_FORMAT_INT16]   = { "int16",    32767,  1.0 },
+    [OUTPUT_FORMAT_INT8]    = { "int8",     127,    (1.0 / 16.0) },
+    [OUTPUT_FORMAT_INT4]    = { "int4",     7,      (1.0 / 256.0) },
+    [OUTPUT_FORMAT_INT2]    = { "int2",     3,      (1.0 / 256.0) },
+    [OUTPUT_FORMAT_FLOAT32] = { "float32",  0,      1.0 }
+};
+
+// The trig table amplitude the default scales are given for (see note 3)
+#define DEFAULT_SCALE_AMPLITUDE (250.0)
+
+#define OUTPUT_FORMAT_COUNT (int)(sizeof(FormatInfo) / sizeof(FormatInfo[0]))
+
+// Set format to the named format with its default scale and clip level. Returns -1 if the name isn't recognised.
+int parseOutputFormat(const char* name, OutputFormat* format) {
+    for (int type = 0; type < OUTPUT_FORMAT_COUNT; type++) {
+        if (strcmp(name, FormatInfo[type].name) == 0) {
+            format->type = type;
+            format->scale = FormatInfo[type].defaultScale;
+
+            if ((type != OUTPUT_FORMAT_INT16) && (type != OUTPUT_FORMAT_FLOAT32)) {
+                format->scale *= (DEFAULT_SCALE_AMPLITUDE / TRIG_TABLE_AMPLITUDE);
+            }
+            format->clipLevel = 0;
+
+            return 0;
+        }
+    }
+
+    return -1;
+}
+
+const char* outputFormatName(const OutputFormat* format) {
+    return FormatInfo[format->type].name;
+}
+
+// Number of shorts a window buffer needs to hold length IQ values once converted
+int outputFormatBufferLength(const OutputFormat* format, int length) {
+    return (format->type == OUTPUT_FORMAT_FLOAT32) ? (2 * length) : length;
+}
+
+// Scale, round and clip one value
+static inline int quantize(short value, double scale, int clipLevel) {
+    long quantized = lrint(value * scale);
+
+    if (quantized > clipLevel) {
+        return clipLevel;
+    }
+
+    else if (quantized < -clipLevel) {
+        return -clipLevel;
+    }
+
+    return (int)quantized;
+}
+
+// Scale one value and pick the nearest of the four 2-bit levels (see note 4). Returns its 2-bit code.
+static inline unsigned char quantizeTwoBit(short value, double scale, int clipLevel) {
+    long level = (2 * (long)floor(value * scale / 2.0)) + 1;
+    long outerLevel = (clipLevel < 3) ? 1 : 3;
+
+    if (level > outerLevel) {
+        level = outerLevel;
+    }
+
+    else if (level < -outerLevel) {
+        level = -outerLevel;
+    }
+
+    return (unsigned char)((level + 3) / 2);
+}
+
+// Convert length interleaved IQ values in buffer to the output format, in place. Returns the number of bytes to output.
+int convertIQSamples(short* buffer, int length, const OutputFormat* format) {
+    int maxValue = FormatInfo[format->type].maxValue;
+    int clipLevel = ((format->clipLevel > 0) && (format->clipLevel < maxValue)) ? format->clipLevel : maxValue;
+    double scale = format->scale;
+
+    unsigned char* bytes = (unsigned char*)buffer;
+
+    switch (format->type) {
+        case OUTPUT_FORMAT_INT16:
+            // Nothing to do unless asked to rescale or clip
+            if ((scale != 1.0) || (clipLevel != maxValue)) {
+                for (int i = 0; i < length; i++) {
+                    buffer[i] = (short)quantize(buffer[i], scale, clipLevel);
+                }
+            }
+
+            return (length * sizeof(short));
+
+        case OUTPUT_FORMAT_INT8:
+            for (int i = 0; i < length; i++) {
+                bytes[i] = (unsigned char)quantize(buffer[i], scale, clipLevel);
+            }
+
+            return length;
+
+        case OUTPUT_FORMAT_INT4:
+            for (int i = 0; i < (length / 2); i++) {
+                int iValue = quantize(buffer[(2 * i)], scale, clipLevel);
+                int qValue = quantize(buffer[(2 * i) + 1], scale, clipLevel);
+
+                bytes[i] = (unsigned char)((iValue & 0xF) | ((qValue & 0xF) << 4));
+            }
+
+            return (length / 2);
+
+        case OUTPUT_FORMAT_INT2:
+            for (int i = 0; i < length; i += 4) {
+                unsigned char packed = 0;
+
+                // The last byte may only be half full
+                for (int value = 0; (value < 4) && ((i + value) < length); value++) {
+                    packed |= (unsigned char)(quantizeTwoBit(buffer[i + value], scale, clipLevel) << (2 * value));
+                }
+
+                bytes[i / 4] = packed;
+            }
+
+            return ((length + 3) / 4);
+
+        case OUTPUT_FORMAT_FLOAT32:
+            // Back to front so no short is overwritten before it has been read
+            // NOTE: Stored with memcpy() as the buffer is also being read as shorts (strict aliasing)
+            for (int i = (length - 1); i >= 0; i--) {
+                float value = (float)(buffer[i] * scale);
+                memcpy(&bytes[i * sizeof(float)], &value, sizeof(float));
+            }
+
+            return (length * sizeof(float));
+    }
+
+    return 0;
+}
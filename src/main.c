@@ -8,21 +8,55 @@
 #include "../include/main.h"
 #include "../include/simulator.h"
 #include "../include/debug.h"
+#include "../include/pacing.h"
+#include "../include/pipeline.h"
+#include "../include/capture.h"
+#include "../include/mixer.h"
+#include "../include/noise.h"
 
 #define GPS_SV_COUNT 32
 
-FILE *OutputFile;
+CaptureSink* OutputCapture;
 zsock_t* OutputSocket;
+StreamPacer OutputPacer;
 
 eph_t Ephemerides[GPS_SV_COUNT];
 
-void dumpFile(short* buffer, int length) {
-    fwrite(buffer, sizeof(buffer[0]), length, OutputFile);
+int dumpFile(void* buffer, int size, int sampleCount, gtime_t time) {
+    return captureWrite(OutputCapture, buffer, size, sampleCount, time);
 }
 
-void dumpSocket(short* buffer, int length) {
-    zsock_send(OutputSocket, "b", buffer, (length * sizeof(short)));
-    zclock_sleep(10);
+// Called by ZMQ once it has finished sending a window
+static void releaseSocketBuffer(void* data, void* hint) {
+    (void)hint;
+    outputBufferRelease(data);
+}
+
+// NOTE: A window that can't be sent is dropped rather than stopping the stream, as subscribers have to cope with lost windows anyway
+int dumpSocket(void* buffer, int size, int sampleCount, gtime_t time) {
+    (void)time;
+
+    // Hold the window back until the subscriber is due it
+    paceStream(&OutputPacer, sampleCount);
+
+    // Send the window straight out of the simulator's buffer rather than copying it into the message.
+    // The buffer stays retained (so synthesis won't overwrite it) until ZMQ calls releaseSocketBuffer().
+    zmq_msg_t message;
+    outputBufferRetain(buffer);
+
+    if (zmq_msg_init_data(&message, buffer, size, releaseSocketBuffer, NULL) != 0) {
+        printf("Error: Could not create ZMQ message (%s)\n", zmq_strerror(zmq_errno()));
+        outputBufferRelease(buffer);
+        return 0;
+    }
+
+    // ZMQ only takes the message if the send works. Otherwise closing it releases the buffer.
+    if (zmq_msg_send(&message, zsock_resolve(OutputSocket), 0) == -1) {
+        printf("Error: Could not send IQ data (%s)\n", zmq_strerror(zmq_errno()));
+        zmq_msg_close(&message);
+    }
+
+    return 0;
 }
 
 static int compareEphemerides(const void *p1, const void *p2) {
@@ -40,7 +74,8 @@ static int compareEphemerides(const void *p1, const void *p2) {
     }
 }
 
-int loadEphemerides(char* filename, eph_t* ephemerides) {
+// Returns how many SVs were loaded, or -1 if there weren't any
+int loadEphemerides(char* filename, eph_t* ephemerides, int maxCount) {
     // Only interested in GPS ephemerides for now
     char* opt = "-SYS=G";
 
@@ -53,6 +88,11 @@ int loadEphemerides(char* filename, eph_t* ephemerides) {
         return -1;
     }
 
+    if (nav.n == 0) {
+        printf("Error: No GPS ephemerides in file\n");
+        return -1;
+    }
+
     // Sort the array based on satellite ID and time of ephemeris
     qsort(nav.eph, nav.n, sizeof(eph_t), compareEphemerides);
 
@@ -72,6 +112,12 @@ int loadEphemerides(char* filename, eph_t* ephemerides) {
 
     // Copy out of nav
     short count = (i + 1);
+
+    if (count > maxCount) {
+        printf("Warning: Only using the first %i of %i SVs\n", maxCount, count);
+        count = maxCount;
+    }
+
     memcpy(ephemerides, nav.eph, (count * sizeof(eph_t)));
 
     // Display result!
@@ -81,7 +127,7 @@ int loadEphemerides(char* filename, eph_t* ephemerides) {
     // Dump the 1st ephemeris entry
     dumpEphemeride(ephemerides, 0);
 
-    return 0;
+    return count;
 }
 
 void showHelp() {
@@ -90,14 +136,55 @@ void showHelp() {
     printf("  -h\t\tShow this help message\n");
     printf("  -e <file>\tSet the ephemerides file. Required!\n");
     printf("  -o <file>\tSet the output file. If no file specified, output will be streamed on ZMQ TCP 5555\n");
+    printf("  -g <file>\tLoad the scenario (sample rate, duration, channel count...) from a file. See scenario.c\n");
+    printf("  -v <NAME=value>\tSet one scenario value, e.g. -v SAMPLE_FREQUENCY_MSPS=8. Overrides the scenario file\n");
+    printf("  -t <count>\tSet the number of synthesis threads. Defaults to 1\n");
+    printf("  -p <count>\tSet the number of IQ windows streamed ahead of real time. Defaults to 5\n");
+    printf("  -f <format>\tSet the output sample format: int16, int8, int4, int2 or float32. Defaults to int16\n");
+    printf("  -s <scale>\tSet the factor IQ values are scaled by before quantisation. Defaults to a per-format value\n");
+    printf("  -c <level>\tSet the level quantised IQ values are clipped to. 0 (default) uses the format's full range\n");
+    printf("  -d\t\tWrite the output file with O_DIRECT, bypassing the page cache\n");
+    printf("  -q <count>\tSet the number of output file writes kept in flight. Defaults to 4\n");
+    printf("  -m <megabytes>\tStart a new output file before one grows past this size. 0 (default) means no limit\n");
+    printf("  -l <seconds>\tStart a new output file after this many seconds of samples. 0 (default) means no limit\n");
+    printf("  -b <count>\tSet the number of IQ windows buffered for the output thread. 0 writes from the synthesis thread. Defaults to 4\n");
+    printf("  -r <seconds>\tSet how often progress and performance counters are reported. 0 only reports at the end. Defaults to 1\n");
+    printf("  -j <file>\tAlso write the reports to a file as JSON lines. Use - for stdout (replaces the console reports)\n");
+    printf("  -x <mixer>\tUse this channel mixer (PORTABLE, SSE2, AVX2 or AVX-512) rather than the widest the CPU supports\n");
+    printf("  -n <generator>\tUse this noise generator (PORTABLE or AVX2) rather than the widest the CPU supports\n");
 }
 
 int main(int argc, char *argv[]) {
-    void (*filePtr)(short*, int) = &dumpFile;
-    void (*socketPtr)(short*, int) = &dumpSocket;
+    OutputCallback filePtr = &dumpFile;
+    OutputCallback socketPtr = &dumpSocket;
 
     char *ephemeridesFilename = NULL;
     char *outputFilename = NULL;
+    char *scenarioFilename = NULL;
+    char *perfFilename = NULL;
+
+    // Scenario values given on the command line are applied after the scenario file, whatever order the flags are in
+    char *scenarioValues[argc];
+    int scenarioValueCount = 0;
+
+    SimulationOptions options = {
+        .threadCount = 1,
+        .outputBufferCount = 4,
+        .perfReport = { .reportInterval_s = 1.0, .jsonFile = NULL }
+    };
+
+    int prerollWindowCount = 5;
+
+    CaptureOptions captureOptions = {
+        .directWrites = false,
+        .writeDepth = 4
+    };
+
+    // Scale and clip level are applied once the format is known, as choosing a format resets them to its defaults
+    double outputScale = 0;
+    int outputClipLevel = -1;
+
+    parseOutputFormat("int16", &options.outputFormat);
 
     // Parse command line arguments
     for (int i = 1; i < argc; i++) {
@@ -134,25 +221,350 @@ int main(int argc, char *argv[]) {
             }
         }
         
+        else if (strcmp(argv[i], "-g") == 0) {
+            if (i + 1 < argc) {
+                scenarioFilename = argv[i + 1];
+
+                // Skip the next argument as it is the filename
+                i++;
+            }
+
+            else {
+                printf("Error: -g flag requires a filename argument\n");
+                return 1;
+            }
+        }
+
+        else if (strcmp(argv[i], "-v") == 0) {
+            if ((i + 1 < argc) && strchr(argv[i + 1], '=')) {
+                scenarioValues[scenarioValueCount++] = argv[i + 1];
+
+                // Skip the next argument as it is the value
+                i++;
+            }
+
+            else {
+                printf("Error: -v flag requires a NAME=value argument\n");
+                return 1;
+            }
+        }
+
+        else if (strcmp(argv[i], "-t") == 0) {
+            if (i + 1 < argc) {
+                options.threadCount = atoi(argv[i + 1]);
+
+                // Skip the next argument as it is the thread count
+                i++;
+            }
+
+            else {
+                printf("Error: -t flag requires a thread count argument\n");
+                return 1;
+            }
+
+            if (options.threadCount < 1) {
+                printf("Error: Thread count must be at least 1\n");
+                return 1;
+            }
+        }
+
+        else if (strcmp(argv[i], "-p") == 0) {
+            if (i + 1 < argc) {
+                prerollWindowCount = atoi(argv[i + 1]);
+
+                // Skip the next argument as it is the window count
+                i++;
+            }
+
+            else {
+                printf("Error: -p flag requires a window count argument\n");
+                return 1;
+            }
+
+            if (prerollWindowCount < 0) {
+                printf("Error: Pre-roll window count cannot be negative\n");
+                return 1;
+            }
+        }
+
+        else if (strcmp(argv[i], "-f") == 0) {
+            if (i + 1 < argc) {
+                if (parseOutputFormat(argv[i + 1], &options.outputFormat) != 0) {
+                    printf("Error: Unknown output format '%s'\n", argv[i + 1]);
+                    return 1;
+                }
+
+                // Skip the next argument as it is the format name
+                i++;
+            }
+
+            else {
+                printf("Error: -f flag requires a format argument\n");
+                return 1;
+            }
+        }
+
+        else if (strcmp(argv[i], "-s") == 0) {
+            if (i + 1 < argc) {
+                outputScale = atof(argv[i + 1]);
+
+                // Skip the next argument as it is the scale
+                i++;
+            }
+
+            else {
+                printf("Error: -s flag requires a scale argument\n");
+                return 1;
+            }
+
+            if (outputScale <= 0) {
+                printf("Error: Scale must be greater than 0\n");
+                return 1;
+            }
+        }
+
+        else if (strcmp(argv[i], "-c") == 0) {
+            if (i + 1 < argc) {
+                outputClipLevel = atoi(argv[i + 1]);
+
+                // Skip the next argument as it is the clip level
+                i++;
+            }
+
+            else {
+                printf("Error: -c flag requires a level argument\n");
+                return 1;
+            }
+
+            if (outputClipLevel < 0) {
+                printf("Error: Clip level cannot be negative\n");
+                return 1;
+            }
+        }
+
+        else if (strcmp(argv[i], "-d") == 0) {
+            captureOptions.directWrites = true;
+        }
+
+        else if (strcmp(argv[i], "-q") == 0) {
+            if (i + 1 < argc) {
+                captureOptions.writeDepth = atoi(argv[i + 1]);
+
+                // Skip the next argument as it is the write count
+                i++;
+            }
+
+            else {
+                printf("Error: -q flag requires a write count argument\n");
+                return 1;
+            }
+
+            if (captureOptions.writeDepth < 1) {
+                printf("Error: Write count must be at least 1\n");
+                return 1;
+            }
+        }
+
+        else if (strcmp(argv[i], "-m") == 0) {
+            if (i + 1 < argc) {
+                captureOptions.maxFileBytes = (long long)(atof(argv[i + 1]) * 1000000.0);
+
+                // Skip the next argument as it is the file size
+                i++;
+            }
+
+            else {
+                printf("Error: -m flag requires a size argument\n");
+                return 1;
+            }
+
+            if (captureOptions.maxFileBytes < 0) {
+                printf("Error: File size cannot be negative\n");
+                return 1;
+            }
+        }
+
+        else if (strcmp(argv[i], "-l") == 0) {
+            if (i + 1 < argc) {
+                captureOptions.maxFileDuration_s = atof(argv[i + 1]);
+
+                // Skip the next argument as it is the file duration
+                i++;
+            }
+
+            else {
+                printf("Error: -l flag requires a duration argument\n");
+                return 1;
+            }
+
+            if (captureOptions.maxFileDuration_s < 0) {
+                printf("Error: File duration cannot be negative\n");
+                return 1;
+            }
+        }
+
+        else if (strcmp(argv[i], "-b") == 0) {
+            if (i + 1 < argc) {
+                options.outputBufferCount = atoi(argv[i + 1]);
+
+                // Skip the next argument as it is the buffer count
+                i++;
+            }
+
+            else {
+                printf("Error: -b flag requires a buffer count argument\n");
+                return 1;
+            }
+
+            if (options.outputBufferCount < 0) {
+                printf("Error: Buffer count cannot be negative\n");
+                return 1;
+            }
+        }
+
+        else if (strcmp(argv[i], "-r") == 0) {
+            if (i + 1 < argc) {
+                options.perfReport.reportInterval_s = atof(argv[i + 1]);
+
+                // Skip the next argument as it is the report interval
+                i++;
+            }
+
+            else {
+                printf("Error: -r flag requires an interval argument\n");
+                return 1;
+            }
+
+            if (options.perfReport.reportInterval_s < 0) {
+                printf("Error: Report interval cannot be negative\n");
+                return 1;
+            }
+        }
+
+        else if (strcmp(argv[i], "-j") == 0) {
+            if (i + 1 < argc) {
+                perfFilename = argv[i + 1];
+
+                // Skip the next argument as it is the filename
+                i++;
+            }
+
+            else {
+                printf("Error: -j flag requires a filename argument\n");
+                return 1;
+            }
+        }
+
+        else if (strcmp(argv[i], "-x") == 0) {
+            if (i + 1 < argc) {
+                options.mixerName = argv[i + 1];
+
+                // Skip the next argument as it is the mixer name
+                i++;
+            }
+
+            else {
+                printf("Error: -x flag requires a mixer name argument\n");
+                return 1;
+            }
+
+            ChannelMixer mixer;
+
+            if (!findChannelMixer(options.mixerName, &mixer)) {
+                printf("Error: This CPU doesn't support a '%s' channel mixer\n", options.mixerName);
+                return 1;
+            }
+        }
+
+        else if (strcmp(argv[i], "-n") == 0) {
+            if (i + 1 < argc) {
+                options.noiseGeneratorName = argv[i + 1];
+
+                // Skip the next argument as it is the generator name
+                i++;
+            }
+
+            else {
+                printf("Error: -n flag requires a noise generator name argument\n");
+                return 1;
+            }
+
+            NoiseGenerator generator;
+
+            if (!findNoiseGenerator(options.noiseGeneratorName, &generator)) {
+                printf("Error: This CPU doesn't support a '%s' noise generator\n", options.noiseGeneratorName);
+                return 1;
+            }
+        }
+
         else {
             printf("Error: Unknown option '%s'\n", argv[i]);
             return 1;
         }
     }
 
+    if (outputScale > 0) {
+        options.outputFormat.scale = outputScale;
+    }
+
+    if (outputClipLevel >= 0) {
+        options.outputFormat.clipLevel = outputClipLevel;
+    }
+
+    defaultScenario(&Scenario);
+
+    if (scenarioFilename && (loadScenarioFile(scenarioFilename, &Scenario) != 0)) {
+        return 1;
+    }
+
+    for (int i = 0; i < scenarioValueCount; i++) {
+        char* separator = strchr(scenarioValues[i], '=');
+        *separator = '\0';
+
+        if (setScenarioValue(&Scenario, scenarioValues[i], (separator + 1)) != 0) {
+            return 1;
+        }
+    }
+
+    if (finaliseScenario(&Scenario) != 0) {
+        return 1;
+    }
+
     if (!ephemeridesFilename) {
         printf("Error: ephemerides must be provided. See help\n");
         return 0;
     }
 
-    loadEphemerides(ephemeridesFilename, Ephemerides);
+    int svCount = loadEphemerides(ephemeridesFilename, Ephemerides, GPS_SV_COUNT);
+
+    if (svCount < 0) {
+        return 1;
+    }
+
+    // Open the performance report stream (see perfcounters.h)
+    if (perfFilename) {
+        options.perfReport.jsonFile = (strcmp(perfFilename, "-") == 0) ? stdout : fopen(perfFilename, "w");
+
+        if (!options.perfReport.jsonFile) {
+            printf("Error: Could not open performance report file '%s'\n", perfFilename);
+            return 1;
+        }
+    }
+
+    // Nonzero if the simulation didn't run to the end (e.g. the output failed)
+    int simulationResult = 0;
 
     // Enter file mode if output file specified
     if (outputFilename) {
         printf("WRITING DATA TO FILE...\n");
-        OutputFile = fopen(outputFilename, "wb");
-        simulate(filePtr, Ephemerides, GPS_SV_COUNT);
-        fclose(OutputFile);
+        captureOptions.filename = outputFilename;
+        OutputCapture = captureOpen(&captureOptions);
+
+        simulationResult = simulate(filePtr, Ephemerides, svCount, &options);
+
+        if (captureClose(OutputCapture) != 0) {
+            return 1;
+        }
     }
 
     // Otherwise, enter streaming mode
@@ -163,7 +575,12 @@ int main(int argc, char *argv[]) {
         // Sleep to give subscriber time to connect
         sleep(1);
 
-        simulate(socketPtr, Ephemerides, GPS_SV_COUNT);
+        // Stream at the sample rate, keeping a few windows in hand
+        initStreamPacer(&OutputPacer, Scenario.sampleRate_Hz, Scenario.windowSampleCount, prerollWindowCount);
+
+        simulationResult = simulate(socketPtr, Ephemerides, svCount, &options);
+
+        reportStreamPacer(&OutputPacer);
 
         // Sleep to give subscriber time to collect
         sleep(1);
@@ -171,5 +588,9 @@ int main(int argc, char *argv[]) {
         zsock_destroy(&OutputSocket);
     }
 
-    return 0;
+    if (options.perfReport.jsonFile && (options.perfReport.jsonFile != stdout)) {
+        fclose(options.perfReport.jsonFile);
+    }
+
+    return (simulationResult == 0) ? 0 : 1;
 }
\ No newline at end of file
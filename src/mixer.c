@@ -0,0 +1,506 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#include "../libs/rtklib-2.4.3/src/rtklib.h"
+
+#include "../include/simulator.h"
+#include "../include/mixer.h"
+#include "../include/synthesis.h"
+#include "../include/trig-tables.h"
+
+// NOTES:
+// 1. Every mixer produces exactly the same output. The vector versions just do more samples per instruction.
+// 2. The vector versions are compiled with GCC target attributes rather than global -m flags, so one binary runs
+//    on any x86-64 machine and selectChannelMixer() picks the widest version the host supports at startup. Any other
+//    supported version can be picked by name with findChannelMixer() (gnss-sim -x), so they can be checked against each other.
+// 3. "(x ^ mask) - mask" negates x when mask is -1 and leaves it alone when mask is 0. This replaces the
+//    "((x * 2) - 1)" multiplies used by the reference kernel.
+// 4. The carrier NCO is second order: the phase advances by the rate every sample and the rate by carrierRateStep.
+//    The vector versions run one NCO per lane, each a vector width of samples apart, so a lane's phase moves on by
+//    (width * rate) + ((width * (width - 1)) / 2 * step) per iteration. All of it is exact modulo 2^64.
+// 5. Each trig table entry packs a phase's cosine and sine into 32 bits, so a sample's I and Q come from one load
+//    (one gather per vector). With TRIG_TABLE_INTERPOLATION the next entry is read too and the two are interpolated
+//    using the MIXER_INTERPOLATION_BITS of phase below the index.
+// 6. Each mixer is written once as an always inlined body taking "gained", and built twice: with the gain multiply
+//    (mixChannel...Gain) and without it. A scenario with every channel at the same power never pays for the multiply.
+// 7. The channels are summed in 32 bits and only saturated to shorts once, by the IQ packer, which counts every value it clips.
+// 8. Each mixer is also built for exactly SYNTHESIS_BLOCK_SAMPLE_COUNT samples (mixChannel...Block), for the synthesis
+//    specialisations (see synthesis.c). With the length a constant the vector loop's trip count is known and the scalar
+//    tail drops out whenever the block is a whole number of vectors.
+
+#define MIXER_INTERPOLATION_BITS    (12)
+#define MIXER_INTERPOLATION_SHIFT   (NCO_CARRIER_INDEX_SHIFT - MIXER_INTERPOLATION_BITS)
+#define MIXER_INTERPOLATION_MASK    ((1 << MIXER_INTERPOLATION_BITS) - 1)
+
+// Move a carrier NCO on by sampleCount samples in one go
+static inline void advanceCarrierNCO(uint64_t* carrierPhase, uint64_t* carrierRate, uint64_t carrierRateStep, uint64_t sampleCount) {
+    *carrierPhase += (sampleCount * *carrierRate) + (((sampleCount * (sampleCount - 1)) / 2) * carrierRateStep);
+    *carrierRate += (sampleCount * carrierRateStep);
+}
+
+// Cosine and sine of a carrier NCO phase (see note 5)
+static inline void carrierTrig(uint64_t phase, int32_t* cosine, int32_t* sine) {
+    int32_t index = (int32_t)(phase >> NCO_CARRIER_INDEX_SHIFT);
+    int32_t entry = trigTable[index];
+
+    *cosine = TRIG_TABLE_COS(entry);
+    *sine = TRIG_TABLE_SIN(entry);
+
+#if TRIG_TABLE_INTERPOLATION
+    int32_t fraction = (int32_t)((phase >> MIXER_INTERPOLATION_SHIFT) & MIXER_INTERPOLATION_MASK);
+    int32_t next = trigTable[index + 1];
+
+    *cosine += ((TRIG_TABLE_COS(next) - *cosine) * fraction) >> MIXER_INTERPOLATION_BITS;
+    *sine += ((TRIG_TABLE_SIN(next) - *sine) * fraction) >> MIXER_INTERPOLATION_BITS;
+#endif
+}
+
+static inline __attribute__((always_inline)) void mixChannelPortableBody(int32_t* iAccumulator, int32_t* qAccumulator, const int32_t* signMask, uint64_t* carrierPhase, uint64_t* carrierRate, uint64_t carrierRateStep, int32_t gain, int sampleCount, const bool gained) {
+    uint64_t phase = *carrierPhase;
+    uint64_t rate = *carrierRate;
+
+    for (int i = 0; i < sampleCount; i++) {
+        int32_t cosine, sine;
+
+        carrierTrig(phase, &cosine, &sine);
+
+        if (gained) {
+            cosine *= gain;
+            sine *= gain;
+        }
+
+        iAccumulator[i] += (cosine ^ signMask[i]) - signMask[i];
+        qAccumulator[i] += (sine ^ signMask[i]) - signMask[i];
+
+        phase += rate;
+        rate += carrierRateStep;
+    }
+
+    *carrierPhase = phase;
+    *carrierRate = rate;
+}
+
+static void mixChannelPortable(int32_t* iAccumulator, int32_t* qAccumulator, const int32_t* signMask, uint64_t* carrierPhase, uint64_t* carrierRate, uint64_t carrierRateStep, int32_t gain, int sampleCount) {
+    mixChannelPortableBody(iAccumulator, qAccumulator, signMask, carrierPhase, carrierRate, carrierRateStep, gain, sampleCount, false);
+}
+
+static void mixChannelPortableGain(int32_t* iAccumulator, int32_t* qAccumulator, const int32_t* signMask, uint64_t* carrierPhase, uint64_t* carrierRate, uint64_t carrierRateStep, int32_t gain, int sampleCount) {
+    mixChannelPortableBody(iAccumulator, qAccumulator, signMask, carrierPhase, carrierRate, carrierRateStep, gain, sampleCount, true);
+}
+
+// As above, for one whole block (see note 8). sampleCount is ignored.
+static void mixChannelPortableBlock(int32_t* iAccumulator, int32_t* qAccumulator, const int32_t* signMask, uint64_t* carrierPhase, uint64_t* carrierRate, uint64_t carrierRateStep, int32_t gain, int sampleCount) {
+    (void)sampleCount;
+    mixChannelPortableBody(iAccumulator, qAccumulator, signMask, carrierPhase, carrierRate, carrierRateStep, gain, SYNTHESIS_BLOCK_SAMPLE_COUNT, false);
+}
+
+static void mixChannelPortableGainBlock(int32_t* iAccumulator, int32_t* qAccumulator, const int32_t* signMask, uint64_t* carrierPhase, uint64_t* carrierRate, uint64_t carrierRateStep, int32_t gain, int sampleCount) {
+    (void)sampleCount;
+    mixChannelPortableBody(iAccumulator, qAccumulator, signMask, carrierPhase, carrierRate, carrierRateStep, gain, SYNTHESIS_BLOCK_SAMPLE_COUNT, true);
+}
+
+// Round, shift and saturate one summed value to a short, counting it if it had to be clipped
+static inline short saturateIQValue(int32_t value, int32_t rounding, int shift, int* saturatedCount) {
+    value = (value + rounding) >> shift;
+
+    if (value > INT16_MAX) {
+        (*saturatedCount)++;
+        return INT16_MAX;
+    }
+
+    else if (value < INT16_MIN) {
+        (*saturatedCount)++;
+        return INT16_MIN;
+    }
+
+    return (short)value;
+}
+
+static int packIQPortable(short* iqBuffer, const int32_t* iAccumulator, const int32_t* qAccumulator, int shift, int sampleCount) {
+    int32_t rounding = (shift > 0) ? (1 << (shift - 1)) : 0;
+    int saturatedCount = 0;
+
+    for (int i = 0; i < sampleCount; i++) {
+        iqBuffer[(2 * i)] = saturateIQValue(iAccumulator[i], rounding, shift, &saturatedCount);
+        iqBuffer[(2 * i) + 1] = saturateIQValue(qAccumulator[i], rounding, shift, &saturatedCount);
+    }
+
+    return saturatedCount;
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+
+// SSE2 has no gather instruction or 32-bit multiply, so the table lookups and gains are done one lane at a time
+__attribute__((target("sse2")))
+static inline __attribute__((always_inline)) void mixChannelSSE2Body(int32_t* iAccumulator, int32_t* qAccumulator, const int32_t* signMask, uint64_t* carrierPhase, uint64_t* carrierRate, uint64_t carrierRateStep, int32_t gain, int sampleCount, const bool gained) {
+    uint64_t phase = *carrierPhase;
+    uint64_t rate = *carrierRate;
+
+    int i = 0;
+
+    for (; (i + 4) <= sampleCount; i += 4) {
+        int32_t laneCosine[4];
+        int32_t laneSine[4];
+
+        for (int lane = 0; lane < 4; lane++) {
+            carrierTrig(phase, &laneCosine[lane], &laneSine[lane]);
+
+            if (gained) {
+                laneCosine[lane] *= gain;
+                laneSine[lane] *= gain;
+            }
+
+            phase += rate;
+            rate += carrierRateStep;
+        }
+
+        __m128i cosine = _mm_loadu_si128((const __m128i*)laneCosine);
+        __m128i sine = _mm_loadu_si128((const __m128i*)laneSine);
+        __m128i mask = _mm_loadu_si128((const __m128i*)&signMask[i]);
+
+        cosine = _mm_sub_epi32(_mm_xor_si128(cosine, mask), mask);
+        sine = _mm_sub_epi32(_mm_xor_si128(sine, mask), mask);
+
+        _mm_storeu_si128((__m128i*)&iAccumulator[i], _mm_add_epi32(_mm_loadu_si128((const __m128i*)&iAccumulator[i]), cosine));
+        _mm_storeu_si128((__m128i*)&qAccumulator[i], _mm_add_epi32(_mm_loadu_si128((const __m128i*)&qAccumulator[i]), sine));
+    }
+
+    *carrierPhase = phase;
+    *carrierRate = rate;
+
+    mixChannelPortableBody(&iAccumulator[i], &qAccumulator[i], &signMask[i], carrierPhase, carrierRate, carrierRateStep, gain, (sampleCount - i), gained);
+}
+
+__attribute__((target("sse2")))
+static void mixChannelSSE2(int32_t* iAccumulator, int32_t* qAccumulator, const int32_t* signMask, uint64_t* carrierPhase, uint64_t* carrierRate, uint64_t carrierRateStep, int32_t gain, int sampleCount) {
+    mixChannelSSE2Body(iAccumulator, qAccumulator, signMask, carrierPhase, carrierRate, carrierRateStep, gain, sampleCount, false);
+}
+
+__attribute__((target("sse2")))
+static void mixChannelSSE2Gain(int32_t* iAccumulator, int32_t* qAccumulator, const int32_t* signMask, uint64_t* carrierPhase, uint64_t* carrierRate, uint64_t carrierRateStep, int32_t gain, int sampleCount) {
+    mixChannelSSE2Body(iAccumulator, qAccumulator, signMask, carrierPhase, carrierRate, carrierRateStep, gain, sampleCount, true);
+}
+
+// As above, for one whole block (see note 8). sampleCount is ignored.
+__attribute__((target("sse2")))
+static void mixChannelSSE2Block(int32_t* iAccumulator, int32_t* qAccumulator, const int32_t* signMask, uint64_t* carrierPhase, uint64_t* carrierRate, uint64_t carrierRateStep, int32_t gain, int sampleCount) {
+    (void)sampleCount;
+    mixChannelSSE2Body(iAccumulator, qAccumulator, signMask, carrierPhase, carrierRate, carrierRateStep, gain, SYNTHESIS_BLOCK_SAMPLE_COUNT, false);
+}
+
+__attribute__((target("sse2")))
+static void mixChannelSSE2GainBlock(int32_t* iAccumulator, int32_t* qAccumulator, const int32_t* signMask, uint64_t* carrierPhase, uint64_t* carrierRate, uint64_t carrierRateStep, int32_t gain, int sampleCount) {
+    (void)sampleCount;
+    mixChannelSSE2Body(iAccumulator, qAccumulator, signMask, carrierPhase, carrierRate, carrierRateStep, gain, SYNTHESIS_BLOCK_SAMPLE_COUNT, true);
+}
+
+// Saturate eight samples at a time with one pack per I and Q vector pair. Every x86-64 CPU has SSE2, so this is the only vector packer.
+__attribute__((target("sse2")))
+static int packIQSSE2(short* iqBuffer, const int32_t* iAccumulator, const int32_t* qAccumulator, int shift, int sampleCount) {
+    __m128i rounding = _mm_set1_epi32((shift > 0) ? (1 << (shift - 1)) : 0);
+    __m128i shiftCount = _mm_cvtsi32_si128(shift);
+    __m128i maximum = _mm_set1_epi32(INT16_MAX);
+    __m128i minimum = _mm_set1_epi32(INT16_MIN);
+
+    // Each lane counts down once for every value it clips (comparisons give -1 when true)
+    __m128i saturated = _mm_setzero_si128();
+
+    int i = 0;
+
+    for (; (i + 8) <= sampleCount; i += 8) {
+        __m128i value[4] = {
+            _mm_loadu_si128((const __m128i*)&iAccumulator[i]),
+            _mm_loadu_si128((const __m128i*)&iAccumulator[i + 4]),
+            _mm_loadu_si128((const __m128i*)&qAccumulator[i]),
+            _mm_loadu_si128((const __m128i*)&qAccumulator[i + 4])
+        };
+
+        for (int v = 0; v < 4; v++) {
+            value[v] = _mm_sra_epi32(_mm_add_epi32(value[v], rounding), shiftCount);
+            saturated = _mm_add_epi32(saturated, _mm_cmpgt_epi32(value[v], maximum));
+            saturated = _mm_add_epi32(saturated, _mm_cmplt_epi32(value[v], minimum));
+        }
+
+        __m128i iPacked = _mm_packs_epi32(value[0], value[1]);
+        __m128i qPacked = _mm_packs_epi32(value[2], value[3]);
+
+        _mm_storeu_si128((__m128i*)&iqBuffer[(2 * i)], _mm_unpacklo_epi16(iPacked, qPacked));
+        _mm_storeu_si128((__m128i*)&iqBuffer[(2 * i) + 8], _mm_unpackhi_epi16(iPacked, qPacked));
+    }
+
+    int32_t laneSaturated[4];
+    _mm_storeu_si128((__m128i*)laneSaturated, saturated);
+
+    int saturatedCount = -(laneSaturated[0] + laneSaturated[1] + laneSaturated[2] + laneSaturated[3]);
+
+    return saturatedCount + packIQPortable(&iqBuffer[(2 * i)], &iAccumulator[i], &qAccumulator[i], shift, (sampleCount - i));
+}
+
+// Look up the cosines and sines for eight phases, held four to a vector in low and high (see note 5)
+__attribute__((target("avx2")))
+static inline void carrierTrigAVX2(__m256i low, __m256i high, __m256i* cosine, __m256i* sine) {
+    // Interleaving the two halves' indices leaves them in lane order 0 4 1 5 2 6 3 7. This puts them back.
+    __m256i order = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+
+    __m256i index = _mm256_or_si256(_mm256_srli_epi64(low, NCO_CARRIER_INDEX_SHIFT), _mm256_slli_epi64(_mm256_srli_epi64(high, NCO_CARRIER_INDEX_SHIFT), 32));
+    index = _mm256_permutevar8x32_epi32(index, order);
+
+    __m256i entry = _mm256_i32gather_epi32((const int*)trigTable, index, 4);
+
+    *cosine = _mm256_srai_epi32(_mm256_slli_epi32(entry, 16), 16);
+    *sine = _mm256_srai_epi32(entry, 16);
+
+#if TRIG_TABLE_INTERPOLATION
+    __m256i fractionMask = _mm256_set1_epi64x(MIXER_INTERPOLATION_MASK);
+    __m256i fractionLow = _mm256_and_si256(_mm256_srli_epi64(low, MIXER_INTERPOLATION_SHIFT), fractionMask);
+    __m256i fractionHigh = _mm256_and_si256(_mm256_srli_epi64(high, MIXER_INTERPOLATION_SHIFT), fractionMask);
+    __m256i fraction = _mm256_permutevar8x32_epi32(_mm256_or_si256(fractionLow, _mm256_slli_epi64(fractionHigh, 32)), order);
+
+    __m256i next = _mm256_i32gather_epi32((const int*)&trigTable[1], index, 4);
+    __m256i nextCosine = _mm256_srai_epi32(_mm256_slli_epi32(next, 16), 16);
+    __m256i nextSine = _mm256_srai_epi32(next, 16);
+
+    *cosine = _mm256_add_epi32(*cosine, _mm256_srai_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(nextCosine, *cosine), fraction), MIXER_INTERPOLATION_BITS));
+    *sine = _mm256_add_epi32(*sine, _mm256_srai_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(nextSine, *sine), fraction), MIXER_INTERPOLATION_BITS));
+#endif
+}
+
+__attribute__((target("avx2")))
+static inline __attribute__((always_inline)) void mixChannelAVX2Body(int32_t* iAccumulator, int32_t* qAccumulator, const int32_t* signMask, uint64_t* carrierPhase, uint64_t* carrierRate, uint64_t carrierRateStep, int32_t gain, int sampleCount, const bool gained) {
+    // Carrier NCO for eight consecutive samples, split over two vectors of four 64-bit phases and rates
+    uint64_t lanePhase[8];
+    uint64_t laneRate[8];
+    uint64_t phase = *carrierPhase;
+    uint64_t rate = *carrierRate;
+
+    for (int lane = 0; lane < 8; lane++) {
+        lanePhase[lane] = phase;
+        laneRate[lane] = rate;
+
+        phase += rate;
+        rate += carrierRateStep;
+    }
+
+    __m256i phaseLow = _mm256_loadu_si256((const __m256i*)&lanePhase[0]);
+    __m256i phaseHigh = _mm256_loadu_si256((const __m256i*)&lanePhase[4]);
+    __m256i rateLow = _mm256_loadu_si256((const __m256i*)&laneRate[0]);
+    __m256i rateHigh = _mm256_loadu_si256((const __m256i*)&laneRate[4]);
+    __m256i phaseStepOffset = _mm256_set1_epi64x(28 * carrierRateStep);
+    __m256i rateStep = _mm256_set1_epi64x(8 * carrierRateStep);
+    __m256i gainVector = _mm256_set1_epi32(gain);
+
+    int i = 0;
+
+    for (; (i + 8) <= sampleCount; i += 8) {
+        __m256i cosine, sine;
+
+        carrierTrigAVX2(phaseLow, phaseHigh, &cosine, &sine);
+
+        if (gained) {
+            cosine = _mm256_mullo_epi32(cosine, gainVector);
+            sine = _mm256_mullo_epi32(sine, gainVector);
+        }
+
+        __m256i mask = _mm256_loadu_si256((const __m256i*)&signMask[i]);
+
+        cosine = _mm256_sub_epi32(_mm256_xor_si256(cosine, mask), mask);
+        sine = _mm256_sub_epi32(_mm256_xor_si256(sine, mask), mask);
+
+        _mm256_storeu_si256((__m256i*)&iAccumulator[i], _mm256_add_epi32(_mm256_loadu_si256((const __m256i*)&iAccumulator[i]), cosine));
+        _mm256_storeu_si256((__m256i*)&qAccumulator[i], _mm256_add_epi32(_mm256_loadu_si256((const __m256i*)&qAccumulator[i]), sine));
+
+        phaseLow = _mm256_add_epi64(phaseLow, _mm256_add_epi64(_mm256_slli_epi64(rateLow, 3), phaseStepOffset));
+        phaseHigh = _mm256_add_epi64(phaseHigh, _mm256_add_epi64(_mm256_slli_epi64(rateHigh, 3), phaseStepOffset));
+        rateLow = _mm256_add_epi64(rateLow, rateStep);
+        rateHigh = _mm256_add_epi64(rateHigh, rateStep);
+    }
+
+    advanceCarrierNCO(carrierPhase, carrierRate, carrierRateStep, i);
+
+    mixChannelPortableBody(&iAccumulator[i], &qAccumulator[i], &signMask[i], carrierPhase, carrierRate, carrierRateStep, gain, (sampleCount - i), gained);
+}
+
+__attribute__((target("avx2")))
+static void mixChannelAVX2(int32_t* iAccumulator, int32_t* qAccumulator, const int32_t* signMask, uint64_t* carrierPhase, uint64_t* carrierRate, uint64_t carrierRateStep, int32_t gain, int sampleCount) {
+    mixChannelAVX2Body(iAccumulator, qAccumulator, signMask, carrierPhase, carrierRate, carrierRateStep, gain, sampleCount, false);
+}
+
+__attribute__((target("avx2")))
+static void mixChannelAVX2Gain(int32_t* iAccumulator, int32_t* qAccumulator, const int32_t* signMask, uint64_t* carrierPhase, uint64_t* carrierRate, uint64_t carrierRateStep, int32_t gain, int sampleCount) {
+    mixChannelAVX2Body(iAccumulator, qAccumulator, signMask, carrierPhase, carrierRate, carrierRateStep, gain, sampleCount, true);
+}
+
+// As above, for one whole block (see note 8). sampleCount is ignored.
+__attribute__((target("avx2")))
+static void mixChannelAVX2Block(int32_t* iAccumulator, int32_t* qAccumulator, const int32_t* signMask, uint64_t* carrierPhase, uint64_t* carrierRate, uint64_t carrierRateStep, int32_t gain, int sampleCount) {
+    (void)sampleCount;
+    mixChannelAVX2Body(iAccumulator, qAccumulator, signMask, carrierPhase, carrierRate, carrierRateStep, gain, SYNTHESIS_BLOCK_SAMPLE_COUNT, false);
+}
+
+__attribute__((target("avx2")))
+static void mixChannelAVX2GainBlock(int32_t* iAccumulator, int32_t* qAccumulator, const int32_t* signMask, uint64_t* carrierPhase, uint64_t* carrierRate, uint64_t carrierRateStep, int32_t gain, int sampleCount) {
+    (void)sampleCount;
+    mixChannelAVX2Body(iAccumulator, qAccumulator, signMask, carrierPhase, carrierRate, carrierRateStep, gain, SYNTHESIS_BLOCK_SAMPLE_COUNT, true);
+}
+
+// Look up the cosines and sines for sixteen phases, held eight to a vector in low and high (see note 5)
+__attribute__((target("avx512f")))
+static inline void carrierTrigAVX512(__m512i low, __m512i high, __m512i* cosine, __m512i* sine) {
+    __m256i indexLow = _mm512_cvtepi64_epi32(_mm512_srli_epi64(low, NCO_CARRIER_INDEX_SHIFT));
+    __m256i indexHigh = _mm512_cvtepi64_epi32(_mm512_srli_epi64(high, NCO_CARRIER_INDEX_SHIFT));
+    __m512i index = _mm512_inserti64x4(_mm512_castsi256_si512(indexLow), indexHigh, 1);
+
+    __m512i entry = _mm512_i32gather_epi32(index, trigTable, 4);
+
+    *cosine = _mm512_srai_epi32(_mm512_slli_epi32(entry, 16), 16);
+    *sine = _mm512_srai_epi32(entry, 16);
+
+#if TRIG_TABLE_INTERPOLATION
+    __m512i fractionMask = _mm512_set1_epi64(MIXER_INTERPOLATION_MASK);
+    __m256i fractionLow = _mm512_cvtepi64_epi32(_mm512_and_si512(_mm512_srli_epi64(low, MIXER_INTERPOLATION_SHIFT), fractionMask));
+    __m256i fractionHigh = _mm512_cvtepi64_epi32(_mm512_and_si512(_mm512_srli_epi64(high, MIXER_INTERPOLATION_SHIFT), fractionMask));
+    __m512i fraction = _mm512_inserti64x4(_mm512_castsi256_si512(fractionLow), fractionHigh, 1);
+
+    __m512i next = _mm512_i32gather_epi32(index, &trigTable[1], 4);
+    __m512i nextCosine = _mm512_srai_epi32(_mm512_slli_epi32(next, 16), 16);
+    __m512i nextSine = _mm512_srai_epi32(next, 16);
+
+    *cosine = _mm512_add_epi32(*cosine, _mm512_srai_epi32(_mm512_mullo_epi32(_mm512_sub_epi32(nextCosine, *cosine), fraction), MIXER_INTERPOLATION_BITS));
+    *sine = _mm512_add_epi32(*sine, _mm512_srai_epi32(_mm512_mullo_epi32(_mm512_sub_epi32(nextSine, *sine), fraction), MIXER_INTERPOLATION_BITS));
+#endif
+}
+
+__attribute__((target("avx512f")))
+static inline __attribute__((always_inline)) void mixChannelAVX512Body(int32_t* iAccumulator, int32_t* qAccumulator, const int32_t* signMask, uint64_t* carrierPhase, uint64_t* carrierRate, uint64_t carrierRateStep, int32_t gain, int sampleCount, const bool gained) {
+    // Carrier NCO for sixteen consecutive samples, split over two vectors of eight 64-bit phases and rates
+    uint64_t lanePhase[16];
+    uint64_t laneRate[16];
+    uint64_t phase = *carrierPhase;
+    uint64_t rate = *carrierRate;
+
+    for (int lane = 0; lane < 16; lane++) {
+        lanePhase[lane] = phase;
+        laneRate[lane] = rate;
+
+        phase += rate;
+        rate += carrierRateStep;
+    }
+
+    __m512i phaseLow = _mm512_loadu_si512(&lanePhase[0]);
+    __m512i phaseHigh = _mm512_loadu_si512(&lanePhase[8]);
+    __m512i rateLow = _mm512_loadu_si512(&laneRate[0]);
+    __m512i rateHigh = _mm512_loadu_si512(&laneRate[8]);
+    __m512i phaseStepOffset = _mm512_set1_epi64(120 * carrierRateStep);
+    __m512i rateStep = _mm512_set1_epi64(16 * carrierRateStep);
+    __m512i gainVector = _mm512_set1_epi32(gain);
+
+    int i = 0;
+
+    for (; (i + 16) <= sampleCount; i += 16) {
+        __m512i cosine, sine;
+
+        carrierTrigAVX512(phaseLow, phaseHigh, &cosine, &sine);
+
+        if (gained) {
+            cosine = _mm512_mullo_epi32(cosine, gainVector);
+            sine = _mm512_mullo_epi32(sine, gainVector);
+        }
+
+        __m512i mask = _mm512_loadu_si512(&signMask[i]);
+
+        cosine = _mm512_sub_epi32(_mm512_xor_si512(cosine, mask), mask);
+        sine = _mm512_sub_epi32(_mm512_xor_si512(sine, mask), mask);
+
+        _mm512_storeu_si512(&iAccumulator[i], _mm512_add_epi32(_mm512_loadu_si512(&iAccumulator[i]), cosine));
+        _mm512_storeu_si512(&qAccumulator[i], _mm512_add_epi32(_mm512_loadu_si512(&qAccumulator[i]), sine));
+
+        phaseLow = _mm512_add_epi64(phaseLow, _mm512_add_epi64(_mm512_slli_epi64(rateLow, 4), phaseStepOffset));
+        phaseHigh = _mm512_add_epi64(phaseHigh, _mm512_add_epi64(_mm512_slli_epi64(rateHigh, 4), phaseStepOffset));
+        rateLow = _mm512_add_epi64(rateLow, rateStep);
+        rateHigh = _mm512_add_epi64(rateHigh, rateStep);
+    }
+
+    advanceCarrierNCO(carrierPhase, carrierRate, carrierRateStep, i);
+
+    mixChannelPortableBody(&iAccumulator[i], &qAccumulator[i], &signMask[i], carrierPhase, carrierRate, carrierRateStep, gain, (sampleCount - i), gained);
+}
+
+__attribute__((target("avx512f")))
+static void mixChannelAVX512(int32_t* iAccumulator, int32_t* qAccumulator, const int32_t* signMask, uint64_t* carrierPhase, uint64_t* carrierRate, uint64_t carrierRateStep, int32_t gain, int sampleCount) {
+    mixChannelAVX512Body(iAccumulator, qAccumulator, signMask, carrierPhase, carrierRate, carrierRateStep, gain, sampleCount, false);
+}
+
+__attribute__((target("avx512f")))
+static void mixChannelAVX512Gain(int32_t* iAccumulator, int32_t* qAccumulator, const int32_t* signMask, uint64_t* carrierPhase, uint64_t* carrierRate, uint64_t carrierRateStep, int32_t gain, int sampleCount) {
+    mixChannelAVX512Body(iAccumulator, qAccumulator, signMask, carrierPhase, carrierRate, carrierRateStep, gain, sampleCount, true);
+}
+
+// As above, for one whole block (see note 8). sampleCount is ignored.
+__attribute__((target("avx512f")))
+static void mixChannelAVX512Block(int32_t* iAccumulator, int32_t* qAccumulator, const int32_t* signMask, uint64_t* carrierPhase, uint64_t* carrierRate, uint64_t carrierRateStep, int32_t gain, int sampleCount) {
+    (void)sampleCount;
+    mixChannelAVX512Body(iAccumulator, qAccumulator, signMask, carrierPhase, carrierRate, carrierRateStep, gain, SYNTHESIS_BLOCK_SAMPLE_COUNT, false);
+}
+
+__attribute__((target("avx512f")))
+static void mixChannelAVX512GainBlock(int32_t* iAccumulator, int32_t* qAccumulator, const int32_t* signMask, uint64_t* carrierPhase, uint64_t* carrierRate, uint64_t carrierRateStep, int32_t gain, int sampleCount) {
+    (void)sampleCount;
+    mixChannelAVX512Body(iAccumulator, qAccumulator, signMask, carrierPhase, carrierRate, carrierRateStep, gain, SYNTHESIS_BLOCK_SAMPLE_COUNT, true);
+}
+
+#endif
+
+// List every mixer this CPU supports, widest first. Returns how many there are.
+// NOTE: __builtin_cpu_supports() only takes a string literal, so each feature has its own check
+int supportedChannelMixers(ChannelMixer mixers[CHANNEL_MIXER_MAX_COUNT]) {
+    int count = 0;
+
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx512f")) {
+        mixers[count++] = (ChannelMixer){ "AVX-512", mixChannelAVX512, mixChannelAVX512Gain, mixChannelAVX512Block, mixChannelAVX512GainBlock, packIQSSE2 };
+    }
+
+    if (__builtin_cpu_supports("avx2")) {
+        mixers[count++] = (ChannelMixer){ "AVX2", mixChannelAVX2, mixChannelAVX2Gain, mixChannelAVX2Block, mixChannelAVX2GainBlock, packIQSSE2 };
+    }
+
+    if (__builtin_cpu_supports("sse2")) {
+        mixers[count++] = (ChannelMixer){ "SSE2", mixChannelSSE2, mixChannelSSE2Gain, mixChannelSSE2Block, mixChannelSSE2GainBlock, packIQSSE2 };
+    }
+#endif
+
+    mixers[count++] = (ChannelMixer){ "PORTABLE", mixChannelPortable, mixChannelPortableGain, mixChannelPortableBlock, mixChannelPortableGainBlock, packIQPortable };
+
+    return count;
+}
+
+// Pick the widest mixer this CPU supports
+ChannelMixer selectChannelMixer(void) {
+    ChannelMixer mixers[CHANNEL_MIXER_MAX_COUNT];
+    supportedChannelMixers(mixers);
+
+    return mixers[0];
+}
+
+// Pick the mixer with this name (e.g. to test it against the others). Returns false if this CPU doesn't support it.
+bool findChannelMixer(const char* name, ChannelMixer* mixer) {
+    ChannelMixer mixers[CHANNEL_MIXER_MAX_COUNT];
+    int count = supportedChannelMixers(mixers);
+
+    for (int i = 0; i < count; i++) {
+        if (strcmp(mixers[i].name, name) == 0) {
+            *mixer = mixers[i];
+            return true;
+        }
+    }
+
+    return false;
+}
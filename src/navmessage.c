@@ -0,0 +1,239 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "../libs/rtklib-2.4.3/src/rtklib.h"
+
+#include "../include/simulator.h"
+#include "../include/navmessage.h"
+
+// NOTES:
+// 1. Words 2 (HOW) and 10 of every subframe end in non-information bearing bits solved so that D29 and D30 are zero.
+//    Every subframe therefore starts after a word ending "00", and the word after the HOW doesn't depend on what the HOW
+//    holds, so each subframe can be encoded on its own, whenever it is needed.
+// 2. That leaves the HOW (TOW) of each subframe, and subframe 1 from word 3 (WN) onwards, as the only parts of a frame that
+//    change with time. Everything else is encoded once per SV and IODE and kept in the SV (navSubframes). Generating a
+//    subframe is then just patching the TOW into its HOW, and re-encoding subframe 1 on the rare occasion the WN changes.
+// 3. "IS-GPS-200N, Table 20-XIV. Parity Encoding Equations" is essential reading for computeParity().
+
+// The parity bits (D25 --> D30) that each byte of a word's data bits (d1 --> d24) contributes to (see initNAVMessages())
+static uint8_t ParityTables[3][256];
+
+// The parity bits that D29* and D30* (the last two bits of the previous word) contribute to
+#define PARITY_D29_STAR_BITS    (0x29UL)
+#define PARITY_D30_STAR_BITS    (0x16UL)
+
+// Build the parity tables from the parity encoding equations
+void initNAVMessages(void) {
+    // The following graciously provided by gps-sdr-sim. Values can be calculated from "IS-GPS-200N, Table 20-XIV. Parity Encoding Equations"
+    unsigned long parityBitMasks[6] = {
+        0x3B1F3480UL,
+        0x1D8F9A40UL,
+        0x2EC7CD00UL,
+        0x1763E680UL,
+        0x2BB1F340UL,
+        0x0B7A89C0UL
+    };
+
+    for (int byte = 0; byte < 3; byte++) {
+        for (unsigned long value = 0; value < 256; value++) {
+            unsigned long d = (value << (6 + (8 * byte)));
+            uint8_t parityBits = 0;
+
+            for (int bit = 0; bit < 6; bit++) {
+                unsigned long masked = (d & parityBitMasks[bit]);
+                uint8_t parity = 0;
+
+                while (masked) {
+                    parity ^= 1;
+                    masked &= (masked - 1);
+                }
+
+                parityBits |= (parity << (5 - bit));
+            }
+
+            ParityTables[byte][value] = parityBits;
+        }
+    }
+}
+
+// Parity bits (D25 --> D30) contributed by d1 --> d24 (bits 29 --> 6 of d)
+static inline unsigned long dataParity(unsigned long d) {
+    return (ParityTables[0][(d >> 6) & 0xFF] ^ ParityTables[1][(d >> 14) & 0xFF] ^ ParityTables[2][(d >> 22) & 0xFF]);
+}
+
+void computeParity(unsigned long* word, unsigned long* previousWord, unsigned short solveNibs) {
+    // Prepend 2 LSBs of the previous transmitted word to this word to form "source"
+    unsigned long source = *word | ((*previousWord << 30) & 0xC0000000UL);
+
+    // Masking source so we have just b1 --> b24
+    unsigned long d = source & 0x3FFFFFC0UL;
+
+    // Accessing D29 and D30 from previous word.
+    unsigned long d29Star = (source >> 31) & 0x1UL;
+    unsigned long d30Star = (source >> 30) & 0x1UL;
+    unsigned long starParity = (d29Star ? PARITY_D29_STAR_BITS : 0) ^ (d30Star ? PARITY_D30_STAR_BITS : 0);
+
+    // If instructed, solve non-information bearing bits 23 and 24 so that D29 and D30 come out as zero.
+    // This is required for words 2 and 10 of each subframe (see note 1).
+    if (solveNibs) {
+        if ((starParity ^ dataParity(d)) & 0x2UL) {
+            d ^= (1UL << 6);
+        }
+
+        if ((starParity ^ dataParity(d)) & 0x1UL) {
+            d ^= (1UL << 7);
+        }
+    }
+
+    unsigned long D = d;
+
+    // The following XORs b1 --> b24 with d30Star (word XOR D30Star will just be word when D30Star is 0)
+    if (d30Star) {
+        D ^= 0x3FFFFFC0UL;
+    }
+
+    D |= (starParity ^ dataParity(d));
+    D &= 0x3FFFFFFFUL;
+
+    *previousWord = D;
+    *word = D;
+}
+
+static void updateTOW(unsigned long* tow_epochs, int* wn, double timeStep_s) {
+    // Cast tow to unsigned to make the operation easier
+    long workingTow_epochs = (signed)(*tow_epochs);
+
+    // Convert timeStep_s to timeStep_epochs
+    long timeStep_epochs = (signed)(timeStep_s / SUBFRAME_DURATION_S);
+
+    // Add timeStep_epochs to tow_epochs
+    workingTow_epochs += timeStep_epochs;
+
+    // Wrap around if result crosses the week boundary (Ref: IS-GPS-200N: 3.3.4 GPS Time and SV Z-Count)
+    if (workingTow_epochs > 100799) {
+        workingTow_epochs -= 100799;
+        *wn += 1;
+    }
+
+    else if (workingTow_epochs < 0) {
+        workingTow_epochs += 100799;
+        *wn -= 1;
+    }
+
+    // Cast and assign the updated value
+    *tow_epochs = (unsigned)workingTow_epochs;
+}
+
+// Encode one of the SV's subframes from its boilerplate, with no TOW and the given WN, into navSubframes
+static void encodeSubframe(SV* sv, int subframe, unsigned long navmessageWn) {
+    // Every subframe follows a word ending "00" (see note 1)
+    unsigned long previousWord = 0;
+
+    memcpy(sv->navSubframes[subframe], sv->navFrameBoilerPlate[subframe], sizeof(sv->navSubframes[subframe]));
+
+    // Add Transmission Week Number to the third word of subframe one.
+    if (subframe == 0) {
+        sv->navSubframes[subframe][2] |= (navmessageWn << 20);
+    }
+
+    for (short word = 0; word < WORD_COUNT; word++) {
+        // solveNibs = "true" when looking at either the 2nd or 10th word.
+        computeParity(&sv->navSubframes[subframe][word], &previousWord, ((word == 1) || (word == 9)));
+    }
+}
+
+// Write a 30-bit word into a packed navbit stream, first transmitted bit at navBit
+static void packNAVWord(uint64_t navBitStream[PACKED_FRAME_WORD_COUNT], int navBit, unsigned long word) {
+    uint64_t bits = 0;
+
+    // Words are transmitted most significant bit first, while packed bit arrays are least significant bit first
+    for (int bit = 0; bit < WORD_BIT_COUNT; bit++) {
+        bits |= (uint64_t)((word >> (29 - bit)) & 0x1) << bit;
+    }
+
+    int index = (navBit >> 6);
+    int offset = (navBit & 63);
+    uint64_t mask = ((1ULL << WORD_BIT_COUNT) - 1);
+
+    navBitStream[index] = (navBitStream[index] & ~(mask << offset)) | (bits << offset);
+
+    // The word may straddle two elements of the stream
+    if (offset > (64 - WORD_BIT_COUNT)) {
+        navBitStream[index + 1] = (navBitStream[index + 1] & ~(mask >> (64 - offset))) | (bits >> (64 - offset));
+    }
+}
+
+// Take the TOW and WN of the frame the channel is about to transmit from the time it starts
+void startNAVFrame(Channel* channel, gtime_t frameTime) {
+    int wn;
+    double tow_s = time2gpst(frameTime, &wn);
+
+    // NOTES:
+    // 1. Convert tow_s to TOW by dividing by TOW epoch duration
+    // 2. See IS-GPS-200N: 20.3.3.2 Handover Word (HOW) and IS-GPS-200N: 3.3.4 GPS Time and SV Z-Count
+    channel->navFrameTow_epochs = (unsigned)(tow_s / SUBFRAME_DURATION_S);
+    channel->navFrameWn = wn;
+}
+
+// Generate one subframe of the channel's current NAV frame into its SV's navBitStream
+void generateNAVSubframe(Channel* channel, int subframe) {
+    SV* sv = channel->sv;
+
+    // The HOW holds the TOW of the start of the next subframe
+    unsigned long tow_epochs = channel->navFrameTow_epochs;
+    int wn = channel->navFrameWn;
+
+    updateTOW(&tow_epochs, &wn, (SUBFRAME_DURATION_S * (subframe + 1)));
+
+    // Mask TOW and WN for safety
+    tow_epochs = tow_epochs & BITMASK(17);
+    unsigned long navmessageWn = wn & BITMASK(10);
+
+    // Encode the parts of the frame that don't change with time if this ephemeris hasn't been seen before
+    if (sv->navSubframesIode != sv->ephemeris.iode) {
+        generateNAVFrameBoilerplate(sv->navFrameBoilerPlate, &sv->ephemeris);
+
+        for (int i = 0; i < SUBFRAME_COUNT; i++) {
+            encodeSubframe(sv, i, navmessageWn);
+        }
+
+        sv->navSubframesIode = sv->ephemeris.iode;
+        sv->navSubframesWn = navmessageWn;
+    }
+
+    else if ((subframe == 0) && (sv->navSubframesWn != navmessageWn)) {
+        encodeSubframe(sv, 0, navmessageWn);
+        sv->navSubframesWn = navmessageWn;
+    }
+
+    // Insert TOW into the HOW (2nd word of subframe). Nothing after it depends on it (see note 1).
+    unsigned long previousWord = sv->navSubframes[subframe][0];
+    unsigned long how = sv->navFrameBoilerPlate[subframe][1] | (tow_epochs << 13);
+
+    computeParity(&how, &previousWord, true);
+
+    int navBit = (subframe * SUBFRAME_BIT_COUNT);
+
+    for (short word = 0; word < WORD_COUNT; word++) {
+        packNAVWord(sv->navBitStream, (navBit + (word * WORD_BIT_COUNT)), ((word == 1) ? how : sv->navSubframes[subframe][word]));
+    }
+}
+
+// Move the channel onto its next navbit, starting the next NAV frame and generating each subframe as it is reached.
+void advanceNavBit(Channel* channel, gtime_t simulationTime) {
+    channel->navBitPointer++;
+
+    // If we've gone past the last bit of this NAV frame, start the next one
+    if (channel->navBitPointer == FRAME_BIT_COUNT) {
+        channel->navBitPointer = 0;
+        startNAVFrame(channel, simulationTime);
+    }
+
+    if ((channel->navBitPointer % SUBFRAME_BIT_COUNT) == 0) {
+        generateNAVSubframe(channel, (channel->navBitPointer / SUBFRAME_BIT_COUNT));
+    }
+
+    // Get the next NAV frame bit
+    channel->navBit = packedBit(channel->sv->navBitStream, channel->navBitPointer);
+}
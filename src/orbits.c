@@ -0,0 +1,214 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "../libs/rtklib-2.4.3/src/rtklib.h"
+
+#include "../include/simulator.h"
+#include "../include/orbits.h"
+
+// NOTES:
+// 1. Gives bit-identical results to calling eph2pos(), geodist() and satazel() for each evaluation in turn. Every
+//    expression is evaluated in the same order as RTKLIB's, just with the per-SV terms worked out once in
+//    orbitBatchCreate() and the receiver's latitude and longitude worked out once per batch rather than per SV.
+// 2. Each stage runs over every evaluation in the batch before the next one starts, with no branches in the loops,
+//    so the compiler is free to vectorise the arithmetic. Kepler's equation is solved for every evaluation in
+//    lockstep. Evaluations that have converged are masked rather than breaking out, so each one stops at exactly
+//    the iteration eph2pos() would have.
+// 3. GPS only (mu and the Earth rotation rate are GPS's), as that's all the simulator loads.
+
+static double* allocateArray(int count) {
+    return (double*)calloc(count, sizeof(double));
+}
+
+// Pull out the terms of each SV's ephemeris that don't depend on time. ephemerides holds one pointer per SV.
+OrbitBatch* orbitBatchCreate(const eph_t* const* ephemerides, int svCount, int capacity) {
+    OrbitBatch* batch = (OrbitBatch*)calloc(1, sizeof(OrbitBatch));
+
+    batch->svCount = svCount;
+    batch->capacity = capacity;
+
+    double** svArrays[] = {
+        &batch->meanMotion, &batch->M0, &batch->e, &batch->A, &batch->ellipseFactor, &batch->omg, &batch->i0, &batch->idot,
+        &batch->OMG0, &batch->OMGRate, &batch->OMGOffset, &batch->cus, &batch->cuc, &batch->crs, &batch->crc, &batch->cis,
+        &batch->cic, &batch->f0, &batch->f1, &batch->f2, &batch->relativityFactor
+    };
+
+    double** evaluationArrays[] = {
+        &batch->toeOffset_s, &batch->tocOffset_s, &batch->eccentricAnomaly, &batch->previousEccentricAnomaly, &batch->meanAnomaly,
+        &batch->position_ecef[0], &batch->position_ecef[1], &batch->position_ecef[2], &batch->clockBias_s, &batch->psuedorange_m, &batch->elevation_rad
+    };
+
+    for (size_t i = 0; i < (sizeof(svArrays) / sizeof(svArrays[0])); i++) {
+        *svArrays[i] = allocateArray(svCount);
+    }
+
+    for (size_t i = 0; i < (sizeof(evaluationArrays) / sizeof(evaluationArrays[0])); i++) {
+        *evaluationArrays[i] = allocateArray(capacity);
+    }
+
+    batch->toe = (gtime_t*)calloc(svCount, sizeof(gtime_t));
+    batch->toc = (gtime_t*)calloc(svCount, sizeof(gtime_t));
+    batch->sv = (int*)calloc(capacity, sizeof(int));
+
+    for (int sv = 0; sv < svCount; sv++) {
+        const eph_t* eph = ephemerides[sv];
+
+        batch->meanMotion[sv] = sqrt(MU_GPS / (eph->A * eph->A * eph->A)) + eph->deln;
+        batch->M0[sv] = eph->M0;
+        batch->e[sv] = eph->e;
+        batch->A[sv] = eph->A;
+        batch->ellipseFactor[sv] = sqrt(1.0 - eph->e * eph->e);
+        batch->omg[sv] = eph->omg;
+        batch->i0[sv] = eph->i0;
+        batch->idot[sv] = eph->idot;
+        batch->OMG0[sv] = eph->OMG0;
+        batch->OMGRate[sv] = (eph->OMGd - OMGE);
+        batch->OMGOffset[sv] = OMGE * eph->toes;
+        batch->cus[sv] = eph->cus;
+        batch->cuc[sv] = eph->cuc;
+        batch->crs[sv] = eph->crs;
+        batch->crc[sv] = eph->crc;
+        batch->cis[sv] = eph->cis;
+        batch->cic[sv] = eph->cic;
+        batch->f0[sv] = eph->f0;
+        batch->f1[sv] = eph->f1;
+        batch->f2[sv] = eph->f2;
+        batch->relativityFactor[sv] = 2.0 * sqrt(MU_GPS * eph->A) * eph->e;
+        batch->toe[sv] = eph->toe;
+        batch->toc[sv] = eph->toc;
+    }
+
+    return batch;
+}
+
+void orbitBatchDestroy(OrbitBatch* batch) {
+    double* arrays[] = {
+        batch->meanMotion, batch->M0, batch->e, batch->A, batch->ellipseFactor, batch->omg, batch->i0, batch->idot,
+        batch->OMG0, batch->OMGRate, batch->OMGOffset, batch->cus, batch->cuc, batch->crs, batch->crc, batch->cis,
+        batch->cic, batch->f0, batch->f1, batch->f2, batch->relativityFactor,
+        batch->toeOffset_s, batch->tocOffset_s, batch->eccentricAnomaly, batch->previousEccentricAnomaly, batch->meanAnomaly,
+        batch->position_ecef[0], batch->position_ecef[1], batch->position_ecef[2], batch->clockBias_s, batch->psuedorange_m, batch->elevation_rad
+    };
+
+    for (size_t i = 0; i < (sizeof(arrays) / sizeof(arrays[0])); i++) {
+        free(arrays[i]);
+    }
+
+    free(batch->toe);
+    free(batch->toc);
+    free(batch->sv);
+    free(batch);
+}
+
+void orbitBatchClear(OrbitBatch* batch) {
+    batch->count = 0;
+}
+
+// Queue up an evaluation of SV number sv's orbit at time. Returns the index its results will be at, or -1 if the batch is full.
+int orbitBatchAdd(OrbitBatch* batch, int sv, gtime_t time) {
+    if (batch->count >= batch->capacity) {
+        return -1;
+    }
+
+    int evaluation = batch->count++;
+
+    // gtime_t arithmetic doesn't vectorise, so the times are turned into offsets here
+    batch->sv[evaluation] = sv;
+    batch->toeOffset_s[evaluation] = timediff(time, batch->toe[sv]);
+    batch->tocOffset_s[evaluation] = timediff(time, batch->toc[sv]);
+
+    return evaluation;
+}
+
+// Run every evaluation in the batch
+void propagateOrbits(OrbitBatch* batch, const double* receiverPosition_ecef) {
+    int count = batch->count;
+    const int* svs = batch->sv;
+
+    double* E = batch->eccentricAnomaly;
+    double* Ek = batch->previousEccentricAnomaly;
+    double* M = batch->meanAnomaly;
+
+    // The receiver's up direction in ECEF, for the elevations (see satazel())
+    double receiverPosition_llh[3];
+    ecef2pos(receiverPosition_ecef, receiverPosition_llh);
+
+    double sinp = sin(receiverPosition_llh[0]);
+    double cosp = cos(receiverPosition_llh[0]);
+    double sinl = sin(receiverPosition_llh[1]);
+    double cosl = cos(receiverPosition_llh[1]);
+    double up_ecef[3] = { (cosp * cosl), (cosp * sinl), sinp };
+
+    // Mean anomalies
+    for (int j = 0; j < count; j++) {
+        M[j] = batch->M0[svs[j]] + batch->meanMotion[svs[j]] * batch->toeOffset_s[j];
+        E[j] = M[j];
+        Ek[j] = 0.0;
+    }
+
+    // Solve Kepler's equation by Newton's method, every evaluation at once
+    for (int iteration = 0; iteration < ORBIT_KEPLER_MAX_ITERATIONS; iteration++) {
+        int converging = 0;
+
+        for (int j = 0; j < count; j++) {
+            double e = batch->e[svs[j]];
+            int active = (fabs(E[j] - Ek[j]) > ORBIT_KEPLER_TOLERANCE);
+            double next = E[j] - (E[j] - e * sin(E[j]) - M[j]) / (1.0 - e * cos(E[j]));
+
+            Ek[j] = active ? E[j] : Ek[j];
+            E[j] = active ? next : E[j];
+            converging |= active;
+        }
+
+        if (!converging) {
+            break;
+        }
+    }
+
+    // Positions, clock biases, pseudoranges and elevations
+    for (int j = 0; j < count; j++) {
+        int sv = svs[j];
+        double tk = batch->toeOffset_s[j];
+        double tc = batch->tocOffset_s[j];
+
+        double sinE = sin(E[j]);
+        double cosE = cos(E[j]);
+        double u = atan2(batch->ellipseFactor[sv] * sinE, cosE - batch->e[sv]) + batch->omg[sv];
+        double r = batch->A[sv] * (1.0 - batch->e[sv] * cosE);
+        double i = batch->i0[sv] + batch->idot[sv] * tk;
+        double sin2u = sin(2.0 * u);
+        double cos2u = cos(2.0 * u);
+
+        u += batch->cus[sv] * sin2u + batch->cuc[sv] * cos2u;
+        r += batch->crs[sv] * sin2u + batch->crc[sv] * cos2u;
+        i += batch->cis[sv] * sin2u + batch->cic[sv] * cos2u;
+
+        double x = r * cos(u);
+        double y = r * sin(u);
+        double cosi = cos(i);
+        double O = batch->OMG0[sv] + batch->OMGRate[sv] * tk - batch->OMGOffset[sv];
+        double sinO = sin(O);
+        double cosO = cos(O);
+
+        double rs[3] = { (x * cosO - y * cosi * sinO), (x * sinO + y * cosi * cosO), (y * sin(i)) };
+
+        batch->position_ecef[0][j] = rs[0];
+        batch->position_ecef[1][j] = rs[1];
+        batch->position_ecef[2][j] = rs[2];
+
+        batch->clockBias_s[j] = batch->f0[sv] + batch->f1[sv] * tc + batch->f2[sv] * tc * tc;
+        batch->clockBias_s[j] -= batch->relativityFactor[sv] * sinE / (CLIGHT * CLIGHT);
+
+        // Geometric range with the Earth rotation correction, as geodist()
+        double lineOfSight[3] = { (rs[0] - receiverPosition_ecef[0]), (rs[1] - receiverPosition_ecef[1]), (rs[2] - receiverPosition_ecef[2]) };
+        double range = sqrt(lineOfSight[2] * lineOfSight[2] + lineOfSight[1] * lineOfSight[1] + lineOfSight[0] * lineOfSight[0]);
+
+        lineOfSight[0] /= range;
+        lineOfSight[1] /= range;
+        lineOfSight[2] /= range;
+
+        batch->psuedorange_m[j] = range + OMGE * (rs[0] * receiverPosition_ecef[1] - rs[1] * receiverPosition_ecef[0]) / CLIGHT;
+        batch->elevation_rad[j] = asin(up_ecef[0] * lineOfSight[0] + up_ecef[1] * lineOfSight[1] + up_ecef[2] * lineOfSight[2]);
+    }
+}
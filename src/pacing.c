@@ -0,0 +1,96 @@
+// Needed for clock_gettime() and clock_nanosleep() under -std=c99
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <errno.h>
+#include <time.h>
+
+#include "../include/pacing.h"
+
+// NOTES:
+// 1. The receiver is assumed to start playing the stream as soon as the first window is sent and to then use one
+//    sample every 1 / sampleRate_Hz. The first prerollWindowCount windows are sent straight away to give it a buffer,
+//    after which each window is held back until the receiver is that many windows from needing it.
+// 2. Deadlines are absolute times on the monotonic clock, so sleep overshoot doesn't build up over a long stream.
+// 3. If a window is sent after the receiver needed it, that's an underrun. The lag is recorded and the schedule is
+//    moved back by it, as the receiver will have stalled for that long.
+// 4. Each underrun is logged as it happens, so a live receiver's stalls can be matched up with the stream while it's
+//    still running rather than only from the summary at the end.
+// 5. Deadlines are worked out from the number of samples sent so far, in whole nanoseconds with integer arithmetic.
+//    Rounding never carries over from one window to the next, so the stream stays locked to sample time even when a
+//    window isn't a whole number of nanoseconds long.
+
+static int64_t monotonicTime_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((int64_t)now.tv_sec * 1000000000LL) + now.tv_nsec;
+}
+
+// Time from the start of the stream until sample number sampleCount is played (see note 5)
+// NOTE: Split into whole seconds and the remainder so the multiply can't overflow, however long the stream
+static int64_t sampleTime_ns(StreamPacer* pacer, uint64_t sampleCount) {
+    uint64_t seconds = (sampleCount / pacer->sampleRate_Hz);
+    uint64_t remainder = (sampleCount % pacer->sampleRate_Hz);
+
+    return (int64_t)((seconds * 1000000000ULL) + ((remainder * 1000000000ULL) / pacer->sampleRate_Hz));
+}
+
+void initStreamPacer(StreamPacer* pacer, uint64_t sampleRate_Hz, int windowSampleCount, int prerollWindowCount) {
+    pacer->sampleRate_Hz = sampleRate_Hz;
+    pacer->prerollTime_ns = sampleTime_ns(pacer, ((uint64_t)prerollWindowCount * windowSampleCount));
+
+    pacer->startTime_ns = 0;
+    pacer->sentSampleCount = 0;
+    pacer->windowCount = 0;
+
+    pacer->underrunCount = 0;
+    pacer->totalLag_ns = 0;
+    pacer->maxLag_ns = 0;
+}
+
+// Call just before sending each window of sampleCount samples. Returns once it's time to send it.
+void paceStream(StreamPacer* pacer, int sampleCount) {
+    int64_t now_ns = monotonicTime_ns();
+
+    // The stream starts with the first window
+    if (pacer->windowCount == 0) {
+        pacer->startTime_ns = now_ns;
+    }
+
+    // When the receiver will need this window, and when it should be sent to keep the pre-roll topped up
+    int64_t neededTime_ns = pacer->startTime_ns + sampleTime_ns(pacer, pacer->sentSampleCount);
+    int64_t sendTime_ns = neededTime_ns - pacer->prerollTime_ns;
+
+    if (now_ns > neededTime_ns) {
+        int64_t lag_ns = (now_ns - neededTime_ns);
+
+        pacer->underrunCount++;
+        pacer->totalLag_ns += lag_ns;
+
+        if (lag_ns > pacer->maxLag_ns) {
+            pacer->maxLag_ns = lag_ns;
+        }
+
+        printf("STREAM UNDERRUN: WINDOW %lu (%.3f s INTO STREAM) | LAG: %.3f s | RUNNING TOTAL: %lu (LAG: %.3f s)\n",
+            pacer->windowCount, ((neededTime_ns - pacer->startTime_ns) / 1e9), (lag_ns / 1e9), pacer->underrunCount, (pacer->totalLag_ns / 1e9));
+        fflush(stdout);
+
+        pacer->startTime_ns += lag_ns;
+    }
+
+    else if (now_ns < sendTime_ns) {
+        struct timespec deadline = { (time_t)(sendTime_ns / 1000000000LL), (long)(sendTime_ns % 1000000000LL) };
+
+        // Carry on sleeping if a signal cuts the sleep short
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR) {
+        }
+    }
+
+    pacer->sentSampleCount += sampleCount;
+    pacer->windowCount++;
+}
+
+void reportStreamPacer(StreamPacer* pacer) {
+    printf("STREAM UNDERRUNS: %lu (TOTAL LAG: %.3f s | MAX LAG: %.3f s)\n", pacer->underrunCount, (pacer->totalLag_ns / 1e9), (pacer->maxLag_ns / 1e9));
+}
@@ -0,0 +1,183 @@
+// Needed for clock_gettime() under -std=c99
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <time.h>
+
+#include "../include/perfcounters.h"
+
+// NOTES:
+// 1. Stages are timed back to back. perfStageEnd() charges the time since the previous stage ended (or since
+//    perfStageBegin()) to its stage, so timing a window costs a clock read per stage and nothing per sample. The
+//    clock read that starts one window's timing also ends the previous one.
+// 2. The output stage runs on the output thread, which keeps its own running total (see pipeline.c). It's picked up
+//    once per window. As it overlaps the other stages, stage shares can add up to more than 100% when pipelined.
+// 3. Stage shares are of wall time. A high OUTPUT WAIT share means synthesis is being held up by the sink. When
+//    streaming, the sink's pacing sleeps count as output time, so the real time factor settles at about 1.
+// 4. Reports are made from the synthesis thread at the end of the first window after each interval, so they're
+//    never more often than once per window.
+
+static const char* PerfStageNames[PERF_STAGE_COUNT] = {
+    "RECEIVER",
+    "ALLOCATION",
+    "ORBITS",
+    "SYNTHESIS",
+    "OUTPUT WAIT",
+    "OUTPUT"
+};
+
+static const char* PerfStageKeys[PERF_STAGE_COUNT] = {
+    "receiver",
+    "allocation",
+    "orbits",
+    "synthesis",
+    "output_wait",
+    "output"
+};
+
+int64_t perfTime_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((int64_t)now.tv_sec * 1000000000LL) + now.tv_nsec;
+}
+
+void initPerfCounters(PerfCounters* counters, const PerfReportOptions* options, double sampleFrequency_Hz, uint64_t totalSampleCount, int queueCapacity) {
+    counters->reportInterval_s = options->reportInterval_s;
+    counters->jsonFile = options->jsonFile;
+
+    counters->sampleFrequency_Hz = sampleFrequency_Hz;
+    counters->totalSampleCount = totalSampleCount;
+    counters->queueCapacity = queueCapacity;
+
+    counters->current = (PerfSnapshot){ 0 };
+    counters->current.time_ns = perfTime_ns();
+
+    counters->stageStartTime_ns = counters->current.time_ns;
+    counters->intervalMaxQueueDepth = 0;
+    counters->maxQueueDepth = 0;
+
+    counters->start = counters->current;
+    counters->lastReport = counters->current;
+}
+
+void perfStageBegin(PerfCounters* counters) {
+    counters->stageStartTime_ns = perfTime_ns();
+}
+
+void perfStageEnd(PerfCounters* counters, PerfStage stage) {
+    int64_t now_ns = perfTime_ns();
+
+    counters->current.stageTimes_ns[stage] += (now_ns - counters->stageStartTime_ns);
+    counters->stageStartTime_ns = now_ns;
+}
+
+// Call once each window has been submitted for output. outputTime_ns is the output thread's running total.
+void perfWindowDone(PerfCounters* counters, int sampleCount, int queueDepth, int64_t outputTime_ns) {
+    PerfSnapshot* current = &counters->current;
+
+    // The window's timing has just ended, so there's no need to read the clock again
+    current->time_ns = counters->stageStartTime_ns;
+    current->sampleCount += sampleCount;
+    current->windowCount++;
+    current->stageTimes_ns[PERF_STAGE_OUTPUT] = outputTime_ns;
+    current->queueDepthTotal += queueDepth;
+
+    if (queueDepth > counters->intervalMaxQueueDepth) {
+        counters->intervalMaxQueueDepth = queueDepth;
+    }
+
+    if (queueDepth > counters->maxQueueDepth) {
+        counters->maxQueueDepth = queueDepth;
+    }
+
+    if ((counters->reportInterval_s > 0) && ((current->time_ns - counters->lastReport.time_ns) >= (int64_t)(counters->reportInterval_s * 1e9))) {
+        reportPerfCounters(counters, false);
+    }
+}
+
+// Call once the output has been flushed at the end of the run. Makes the final report.
+void perfFinish(PerfCounters* counters, int64_t outputTime_ns) {
+    counters->current.time_ns = perfTime_ns();
+    counters->current.stageTimes_ns[PERF_STAGE_OUTPUT] = outputTime_ns;
+
+    reportPerfCounters(counters, true);
+}
+
+static void printPerfLine(PerfCounters* counters, const char* label, const PerfSnapshot* from, int maxQueueDepth) {
+    const PerfSnapshot* to = &counters->current;
+
+    double wall_s = ((to->time_ns - from->time_ns) / 1e9);
+    unsigned long windowCount = (to->windowCount - from->windowCount);
+    double samplesPerSecond = (wall_s > 0) ? ((to->sampleCount - from->sampleCount) / wall_s) : 0;
+
+    printf("%s: %.1f%% | %.2f S | %.2f MSPS | %.2fx REAL TIME | QUEUE: %.1f/%i (MAX: %i)",
+        label,
+        (100.0 * to->sampleCount / counters->totalSampleCount),
+        (to->sampleCount / counters->sampleFrequency_Hz),
+        (samplesPerSecond / 1e6),
+        (samplesPerSecond / counters->sampleFrequency_Hz),
+        (windowCount ? ((double)(to->queueDepthTotal - from->queueDepthTotal) / windowCount) : 0),
+        counters->queueCapacity,
+        maxQueueDepth
+    );
+
+    for (int stage = 0; stage < PERF_STAGE_COUNT; stage++) {
+        double stage_s = ((to->stageTimes_ns[stage] - from->stageTimes_ns[stage]) / 1e9);
+        printf(" | %s: %.1f%%", PerfStageNames[stage], ((wall_s > 0) ? (100.0 * stage_s / wall_s) : 0));
+    }
+
+    printf("\n");
+    fflush(stdout);
+}
+
+static void writePerfJson(PerfCounters* counters, const PerfSnapshot* from, int maxQueueDepth, bool final) {
+    const PerfSnapshot* to = &counters->current;
+    FILE* file = counters->jsonFile;
+
+    double wall_s = ((to->time_ns - from->time_ns) / 1e9);
+    unsigned long windowCount = (to->windowCount - from->windowCount);
+    double samplesPerSecond = (wall_s > 0) ? ((to->sampleCount - from->sampleCount) / wall_s) : 0;
+
+    fprintf(file, "{\"final\": %s, \"elapsed_s\": %.6f, \"interval_s\": %.6f, \"simulated_s\": %.6f, \"progress\": %.6f, ",
+        (final ? "true" : "false"),
+        ((to->time_ns - counters->start.time_ns) / 1e9),
+        wall_s,
+        (to->sampleCount / counters->sampleFrequency_Hz),
+        ((double)to->sampleCount / counters->totalSampleCount)
+    );
+
+    fprintf(file, "\"samples_per_s\": %.1f, \"realtime_factor\": %.4f, \"windows\": %lu, \"queue_depth_mean\": %.3f, \"queue_depth_max\": %i, \"queue_capacity\": %i, \"stage_s\": {",
+        samplesPerSecond,
+        (samplesPerSecond / counters->sampleFrequency_Hz),
+        windowCount,
+        (windowCount ? ((double)(to->queueDepthTotal - from->queueDepthTotal) / windowCount) : 0),
+        maxQueueDepth,
+        counters->queueCapacity
+    );
+
+    for (int stage = 0; stage < PERF_STAGE_COUNT; stage++) {
+        fprintf(file, "%s\"%s\": %.6f", (stage ? ", " : ""), PerfStageKeys[stage], ((to->stageTimes_ns[stage] - from->stageTimes_ns[stage]) / 1e9));
+    }
+
+    fprintf(file, "}}\n");
+    fflush(file);
+}
+
+// Report the counters since the last report or, if final, over the whole run
+// NOTE: Console lines are left out when the JSON lines are going to stdout, so the two aren't mixed up
+void reportPerfCounters(PerfCounters* counters, bool final) {
+    const PerfSnapshot* from = final ? &counters->start : &counters->lastReport;
+    int maxQueueDepth = final ? counters->maxQueueDepth : counters->intervalMaxQueueDepth;
+
+    if (counters->jsonFile != stdout) {
+        printPerfLine(counters, (final ? "PERFORMANCE" : "PROGRESS"), from, maxQueueDepth);
+    }
+
+    if (counters->jsonFile) {
+        writePerfJson(counters, from, maxQueueDepth, final);
+    }
+
+    counters->lastReport = counters->current;
+    counters->intervalMaxQueueDepth = 0;
+}
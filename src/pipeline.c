@@ -0,0 +1,256 @@
+// Needed for nanosleep() under -std=c99
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "../libs/rtklib-2.4.3/src/rtklib.h"
+
+#include "../include/simulator.h"
+#include "../include/pipeline.h"
+#include "../include/perfcounters.h"
+
+// Hands finished IQ windows from synthesis to an output thread so synthesis never waits on the sink.
+// NOTES:
+// 1. The windows live in a ring of preallocated buffers. Synthesis (the only producer) fills the slot at "head", the
+//    output thread (the only consumer) drains the slot at "tail". Each index is only ever written by one side, so
+//    the handoff needs nothing more than atomic loads and stores (no locks).
+// 2. head and tail count windows rather than slots. The slot is the count modulo bufferCount and the number of
+//    windows waiting is simply (head - tail).
+// 3. With a bufferCount of 0 there is no output thread and no ring. Windows go straight to dumpCallback from the
+//    synthesis thread, exactly as before pipelining was added.
+// 4. Windows are converted to the output format (see formats.h) just before they're handed to dumpCallback, so
+//    dumpCallback gets the bytes to write rather than shorts.
+// 5. A sink may hang on to a buffer after dumpCallback returns (e.g. ZMQ sending it without a copy) by retaining it
+//    and releasing it once done. Synthesis won't reuse a buffer until every reference to it has been released.
+// 6. The time spent converting and in dumpCallback is totted up for the performance counters (see perfcounters.c).
+//    Whichever thread does the output adds to it, synthesis only reads it.
+// 7. Once dumpCallback fails the pipeline is stopped. Windows still queued are dropped rather than output, and
+//    synthesis sees the stop the next time it checks outputPipelineStopped().
+
+// Each buffer is preceded by a header holding its reference count. Sized to keep the samples cache line aligned.
+#define OUTPUT_BUFFER_HEADER_SIZE   (64)
+
+struct OutputPipeline {
+    OutputCallback dumpCallback;
+    OutputFormat format;
+
+    short** buffers;
+    int* lengths;
+    gtime_t* times;
+    int bufferCount;
+
+    // Buffers actually allocated. Can be more than bufferCount if the output thread didn't start.
+    int allocatedCount;
+
+    unsigned long head;
+    unsigned long tail;
+    bool finished;
+    bool stopped;
+
+    int64_t outputTime_ns;
+
+    pthread_t outputThread;
+};
+
+static short* allocateOutputBuffer(int length) {
+    char* memory = (char*)calloc(1, (OUTPUT_BUFFER_HEADER_SIZE + (length * sizeof(short))));
+    return (short*)(memory + OUTPUT_BUFFER_HEADER_SIZE);
+}
+
+static void freeOutputBuffer(short* buffer) {
+    free((char*)buffer - OUTPUT_BUFFER_HEADER_SIZE);
+}
+
+static int* outputBufferReferences(void* buffer) {
+    return (int*)((char*)buffer - OUTPUT_BUFFER_HEADER_SIZE);
+}
+
+// Stop synthesis reusing a buffer handed to dumpCallback until outputBufferRelease() is called
+// NOTE: Safe to call from any thread
+void outputBufferRetain(void* buffer) {
+    __atomic_add_fetch(outputBufferReferences(buffer), 1, __ATOMIC_ACQ_REL);
+}
+
+void outputBufferRelease(void* buffer) {
+    __atomic_sub_fetch(outputBufferReferences(buffer), 1, __ATOMIC_ACQ_REL);
+}
+
+static bool outputBufferInUse(short* buffer) {
+    return (__atomic_load_n(outputBufferReferences(buffer), __ATOMIC_ACQUIRE) != 0);
+}
+
+// Convert a window to the output format and hand it to the sink, holding a reference for as long as the sink has it
+static void dumpOutputBuffer(OutputPipeline* pipeline, short* buffer, int length, gtime_t time) {
+    if (outputPipelineStopped(pipeline)) {
+        return;
+    }
+
+    int64_t startTime_ns = perfTime_ns();
+
+    int size = convertIQSamples(buffer, length, &pipeline->format);
+
+    outputBufferRetain(buffer);
+
+    if (pipeline->dumpCallback(buffer, size, (length / 2), time) != 0) {
+        __atomic_store_n(&pipeline->stopped, true, __ATOMIC_RELEASE);
+    }
+
+    outputBufferRelease(buffer);
+
+    __atomic_add_fetch(&pipeline->outputTime_ns, (perfTime_ns() - startTime_ns), __ATOMIC_RELAXED);
+}
+
+// Back off while waiting for the other side. Spin briefly first as the wait is usually short, then sleep so a stalled sink doesn't burn a core.
+static void waitForOtherSide(int* attempts) {
+    if (++(*attempts) < 64) {
+        return;
+    }
+
+    struct timespec delay = { 0, 100000 };
+    nanosleep(&delay, NULL);
+}
+
+static void* outputThreadMain(void* argument) {
+    OutputPipeline* pipeline = (OutputPipeline*)argument;
+    unsigned long tail = pipeline->tail;
+
+    while (true) {
+        int attempts = 0;
+
+        // Wait for a window (or for synthesis to finish)
+        while (__atomic_load_n(&pipeline->head, __ATOMIC_ACQUIRE) == tail) {
+            if (__atomic_load_n(&pipeline->finished, __ATOMIC_ACQUIRE) && (__atomic_load_n(&pipeline->head, __ATOMIC_ACQUIRE) == tail)) {
+                return NULL;
+            }
+
+            waitForOtherSide(&attempts);
+        }
+
+        int slot = (int)(tail % pipeline->bufferCount);
+        dumpOutputBuffer(pipeline, pipeline->buffers[slot], pipeline->lengths[slot], pipeline->times[slot]);
+
+        // Give the slot back to synthesis
+        tail++;
+        __atomic_store_n(&pipeline->tail, tail, __ATOMIC_RELEASE);
+    }
+}
+
+OutputPipeline* outputPipelineCreate(OutputCallback dumpCallback, int bufferCount, int bufferLength, const OutputFormat* format) {
+    OutputPipeline* pipeline = (OutputPipeline*)calloc(1, sizeof(OutputPipeline));
+
+    pipeline->dumpCallback = dumpCallback;
+    pipeline->format = *format;
+    pipeline->bufferCount = (bufferCount < 0) ? 0 : bufferCount;
+
+    // The unpipelined mode still needs one buffer to synthesise into
+    pipeline->allocatedCount = (pipeline->bufferCount > 0) ? pipeline->bufferCount : 1;
+
+    pipeline->buffers = (short**)calloc(pipeline->allocatedCount, sizeof(short*));
+    pipeline->lengths = (int*)calloc(pipeline->allocatedCount, sizeof(int));
+    pipeline->times = (gtime_t*)calloc(pipeline->allocatedCount, sizeof(gtime_t));
+
+    for (int i = 0; i < pipeline->allocatedCount; i++) {
+        pipeline->buffers[i] = allocateOutputBuffer(outputFormatBufferLength(format, bufferLength));
+    }
+
+    if (pipeline->bufferCount > 0) {
+        if (pthread_create(&pipeline->outputThread, NULL, outputThreadMain, pipeline) != 0) {
+            printf("Error: Could not start output thread. Falling back to unpipelined output\n");
+            pipeline->bufferCount = 0;
+        }
+    }
+
+    return pipeline;
+}
+
+// Get the buffer the next window should be synthesised into. Waits if every buffer is still queued for output or held by the sink.
+short* outputPipelineAcquire(OutputPipeline* pipeline) {
+    int attempts = 0;
+
+    if (pipeline->bufferCount == 0) {
+        while (outputBufferInUse(pipeline->buffers[0])) {
+            waitForOtherSide(&attempts);
+        }
+
+        return pipeline->buffers[0];
+    }
+
+    while ((pipeline->head - __atomic_load_n(&pipeline->tail, __ATOMIC_ACQUIRE)) >= (unsigned long)pipeline->bufferCount) {
+        waitForOtherSide(&attempts);
+    }
+
+    short* buffer = pipeline->buffers[pipeline->head % pipeline->bufferCount];
+
+    while (outputBufferInUse(buffer)) {
+        waitForOtherSide(&attempts);
+    }
+
+    return buffer;
+}
+
+// Queue the window in the most recently acquired buffer for output. length counts I and Q values, time is the GPS time of the first sample.
+void outputPipelineSubmit(OutputPipeline* pipeline, int length, gtime_t time) {
+    if (pipeline->bufferCount == 0) {
+        dumpOutputBuffer(pipeline, pipeline->buffers[0], length, time);
+        return;
+    }
+
+    pipeline->lengths[pipeline->head % pipeline->bufferCount] = length;
+    pipeline->times[pipeline->head % pipeline->bufferCount] = time;
+    __atomic_store_n(&pipeline->head, (pipeline->head + 1), __ATOMIC_RELEASE);
+}
+
+// Number of windows waiting to be output
+int outputPipelineDepth(OutputPipeline* pipeline) {
+    if (pipeline->bufferCount == 0) {
+        return 0;
+    }
+
+    return (int)(__atomic_load_n(&pipeline->head, __ATOMIC_ACQUIRE) - __atomic_load_n(&pipeline->tail, __ATOMIC_ACQUIRE));
+}
+
+// True once dumpCallback has failed (see note 7)
+bool outputPipelineStopped(OutputPipeline* pipeline) {
+    return __atomic_load_n(&pipeline->stopped, __ATOMIC_ACQUIRE);
+}
+
+// Total time spent outputting windows so far
+int64_t outputPipelineOutputTime_ns(OutputPipeline* pipeline) {
+    return __atomic_load_n(&pipeline->outputTime_ns, __ATOMIC_RELAXED);
+}
+
+// Wait for every queued window to be output. The pipeline can still be used afterwards.
+void outputPipelineFlush(OutputPipeline* pipeline) {
+    int attempts = 0;
+
+    while (outputPipelineDepth(pipeline) > 0) {
+        waitForOtherSide(&attempts);
+    }
+}
+
+// Wait for every queued window to be output and released by the sink, then tear the pipeline down
+void outputPipelineDestroy(OutputPipeline* pipeline) {
+    if (pipeline->bufferCount > 0) {
+        __atomic_store_n(&pipeline->finished, true, __ATOMIC_RELEASE);
+        pthread_join(pipeline->outputThread, NULL);
+    }
+
+    for (int i = 0; i < pipeline->allocatedCount; i++) {
+        int attempts = 0;
+
+        while (outputBufferInUse(pipeline->buffers[i])) {
+            waitForOtherSide(&attempts);
+        }
+
+        freeOutputBuffer(pipeline->buffers[i]);
+    }
+
+    free(pipeline->buffers);
+    free(pipeline->lengths);
+    free(pipeline->times);
+    free(pipeline);
+}
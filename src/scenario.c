@@ -0,0 +1,175 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+
+#include "../include/scenario.h"
+
+// NOTES:
+// 1. Scenario files hold one "NAME = value" per line. Blank lines and anything after a '#' are ignored.
+// 2. Names are the same as the DEFAULT_ defines without the prefix, e.g. "SAMPLE_FREQUENCY_MSPS = 8".
+//    The -v flag takes the same "NAME=value" pairs and is applied after any file (see main.c).
+// 3. The sample rate must come out as a whole number of samples per second, as simulation time is counted in
+//    samples (see sampleTime()). Durations are rounded to the nearest sample.
+
+#define SCENARIO_LINE_LENGTH (256)
+
+ScenarioConfig Scenario;
+
+typedef struct {
+    const char* name;
+    size_t offset;
+    int isInteger;
+} ScenarioValueInfo;
+
+static const ScenarioValueInfo ValueInfo[] = {
+    { "VISIBILITY_UPDATE_INTERVAL_S",   offsetof(ScenarioConfig, visibilityUpdateInterval_s),   0 },
+    { "SAMPLE_FREQUENCY_MSPS",          offsetof(ScenarioConfig, sampleFrequency_MSPS),         0 },
+    { "SAMPLE_DURATION_S",              offsetof(ScenarioConfig, sampleDuration_s),             0 },
+    { "IQ_SAMPLE_WINDOW_S",             offsetof(ScenarioConfig, iqSampleWindow_s),             0 },
+    { "CHANNEL_COUNT",                  offsetof(ScenarioConfig, channelCount),                 1 },
+    { "SIGNAL_POWER_MODEL",             offsetof(ScenarioConfig, signalPowerModel),             1 },
+    { "SIGNAL_POWER_RANGE_DB",          offsetof(ScenarioConfig, signalPowerRange_dB),          0 },
+    { "NOISE_CN0_DBHZ",                 offsetof(ScenarioConfig, noiseCN0_dBHz),                0 },
+    { "NOISE_SEED",                     offsetof(ScenarioConfig, noiseSeed),                    1 }
+};
+
+#define SCENARIO_VALUE_COUNT (int)(sizeof(ValueInfo) / sizeof(ValueInfo[0]))
+
+void defaultScenario(ScenarioConfig* scenario) {
+    memset(scenario, 0, sizeof(*scenario));
+
+    scenario->visibilityUpdateInterval_s = DEFAULT_VISIBILITY_UPDATE_INTERVAL_S;
+    scenario->sampleFrequency_MSPS = DEFAULT_SAMPLE_FREQUENCY_MSPS;
+    scenario->sampleDuration_s = DEFAULT_SAMPLE_DURATION_S;
+    scenario->iqSampleWindow_s = DEFAULT_IQ_SAMPLE_WINDOW_S;
+    scenario->channelCount = DEFAULT_CHANNEL_COUNT;
+    scenario->signalPowerModel = DEFAULT_SIGNAL_POWER_MODEL;
+    scenario->signalPowerRange_dB = DEFAULT_SIGNAL_POWER_RANGE_DB;
+    scenario->noiseCN0_dBHz = DEFAULT_NOISE_CN0_DBHZ;
+    scenario->noiseSeed = DEFAULT_NOISE_SEED;
+}
+
+// Set the named value from a string. Returns -1 if the name isn't recognised or the value isn't a number.
+int setScenarioValue(ScenarioConfig* scenario, const char* name, const char* value) {
+    for (int i = 0; i < SCENARIO_VALUE_COUNT; i++) {
+        if (strcmp(name, ValueInfo[i].name) != 0) {
+            continue;
+        }
+
+        char* end;
+        double number = strtod(value, &end);
+
+        if ((end == value) || (*end != '\0')) {
+            printf("Error: %s must be a number, not '%s'\n", name, value);
+            return -1;
+        }
+
+        if (ValueInfo[i].isInteger) {
+            *(int*)((char*)scenario + ValueInfo[i].offset) = (int)number;
+        }
+
+        else {
+            *(double*)((char*)scenario + ValueInfo[i].offset) = number;
+        }
+
+        return 0;
+    }
+
+    printf("Error: Unknown scenario value '%s'\n", name);
+    return -1;
+}
+
+int loadScenarioFile(const char* filename, ScenarioConfig* scenario) {
+    FILE* file = fopen(filename, "r");
+
+    if (!file) {
+        printf("Error: Could not open scenario file %s\n", filename);
+        return -1;
+    }
+
+    char line[SCENARIO_LINE_LENGTH];
+    int lineNumber = 0;
+    int result = 0;
+
+    while (fgets(line, sizeof(line), file)) {
+        lineNumber++;
+
+        // Drop comments
+        char* comment = strchr(line, '#');
+
+        if (comment) {
+            *comment = '\0';
+        }
+
+        char name[SCENARIO_LINE_LENGTH];
+        char value[SCENARIO_LINE_LENGTH];
+        char extra;
+
+        // Skip blank lines
+        if (sscanf(line, " %c", &extra) != 1) {
+            continue;
+        }
+
+        if ((sscanf(line, " %255[A-Za-z0-9_] = %255s %c", name, value, &extra) != 2) || (setScenarioValue(scenario, name, value) != 0)) {
+            printf("Error: Could not read line %i of scenario file %s\n", lineNumber, filename);
+            result = -1;
+            break;
+        }
+    }
+
+    fclose(file);
+
+    return result;
+}
+
+// Check the scenario makes sense and work out the values that follow from it. Returns -1 if it doesn't.
+int finaliseScenario(ScenarioConfig* scenario) {
+    double sampleRate_Hz = (scenario->sampleFrequency_MSPS * 1000000.0);
+
+    if ((sampleRate_Hz < 1.0) || (fabs(sampleRate_Hz - round(sampleRate_Hz)) > 1e-6)) {
+        printf("Error: SAMPLE_FREQUENCY_MSPS must be a whole number of samples per second\n");
+        return -1;
+    }
+
+    if ((scenario->channelCount < 1) || (scenario->channelCount > SCENARIO_MAX_CHANNEL_COUNT)) {
+        printf("Error: CHANNEL_COUNT must be between 1 and %i\n", SCENARIO_MAX_CHANNEL_COUNT);
+        return -1;
+    }
+
+    if ((scenario->sampleDuration_s <= 0) || (scenario->visibilityUpdateInterval_s <= 0)) {
+        printf("Error: SAMPLE_DURATION_S and VISIBILITY_UPDATE_INTERVAL_S must be greater than 0\n");
+        return -1;
+    }
+
+    if ((scenario->signalPowerModel != SIGNAL_POWER_MODEL_FIXED) && (scenario->signalPowerModel != SIGNAL_POWER_MODEL_ELEVATION)) {
+        printf("Error: SIGNAL_POWER_MODEL must be %i (fixed) or %i (elevation)\n", SIGNAL_POWER_MODEL_FIXED, SIGNAL_POWER_MODEL_ELEVATION);
+        return -1;
+    }
+
+    if (scenario->signalPowerRange_dB < 0) {
+        printf("Error: SIGNAL_POWER_RANGE_DB can't be negative\n");
+        return -1;
+    }
+
+    if (scenario->noiseCN0_dBHz < 0) {
+        printf("Error: NOISE_CN0_DBHZ can't be negative\n");
+        return -1;
+    }
+
+    scenario->sampleRate_Hz = (uint64_t)llround(sampleRate_Hz);
+    scenario->sampleInterval_s = (1.0 / sampleRate_Hz);
+
+    // Windows are passed around with int sizes, so keep a window's I and Q values within range
+    double windowSampleCount = round(scenario->iqSampleWindow_s * sampleRate_Hz);
+
+    if ((windowSampleCount < 1) || (windowSampleCount > (1 << 28))) {
+        printf("Error: IQ_SAMPLE_WINDOW_S must hold between 1 and %i samples\n", (1 << 28));
+        return -1;
+    }
+
+    scenario->windowSampleCount = (int)windowSampleCount;
+
+    return 0;
+}
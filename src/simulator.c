@@ -2,12 +2,23 @@
 #include <string.h>
 #include <math.h>
 
-#include "../libs/progressbar/progressbar.h"
 #include "../libs/rtklib-2.4.3/src/rtklib.h"
 
 #include "../include/simulator.h"
 #include "../include/debug.h"
-#include "../include/trig-tables.h"
+#include "../include/synthesis.h"
+#include "../include/pipeline.h"
+#include "../include/perfcounters.h"
+#include "../include/codetables.h"
+#include "../include/orbits.h"
+#include "../include/navmessage.h"
+#include "../include/ca-code-tables.h"
+
+// Number of pseudorange model fits done, reported at the end of the simulation (see updateSatellitePositions())
+static unsigned long GeometryUpdateCount;
+
+// Every SV's ephemeris, ready for propagating in batches (see orbits.h)
+static OrbitBatch* Orbits;
 
 // Return a long representing the x multiples of "scale factor" required to express the original double.
 // (This is the technique used in the GPS spec to encode doubles in the navmessage)
@@ -17,6 +28,10 @@ long scaleDouble(double operand, double scaleFactorIndex) {
 }
 
 void generateNAVFrameBoilerplate(unsigned long frame[SUBFRAME_COUNT][WORD_COUNT], eph_t* ephemeris) {
+    // Start from an empty frame. Words not populated below (e.g. most of subframe 5) must be transmitted as zeros
+    // rather than whatever was left on the stack, otherwise the output differs from run to run.
+    memset(frame, 0, (SUBFRAME_COUNT * WORD_COUNT * sizeof(frame[0][0])));
+
     // *** SUBFRAME 1 PARAMETERS ***
     // NOTES:
     // 1. (unsigned) cast required to resolve odd behaviour where compiler was treating 
@@ -178,260 +193,165 @@ void generateNAVFrameBoilerplate(unsigned long frame[SUBFRAME_COUNT][WORD_COUNT]
     }
 }
 
-// The following was script-kiddied from here: https://stackoverflow.com/questions/109023/count-the-number-of-set-bits-in-a-32-bit-integer
-int countSetBits(unsigned long i) {
-    i = i - ((i >> 1) & 0x55555555);                   // Add pairs of bits
-    i = (i & 0x33333333) + ((i >> 2) & 0x33333333);    // Quads
-    i = (i + (i >> 4)) & 0x0F0F0F0F;                   // Groups of 8
-    i *= 0x01010101;                                   // Horizontal sum of bytes
-    return  i >> 24;                                   // Return just that top byte (after truncating to 32-bit even when int is wider than uint32_t)
-}
-
-void computeParity(unsigned long* word, unsigned long* previousWord, unsigned short solveNibs) {
-    // NOTES:
-    // 1. This function is quite heavy! Don't worry about understanding it perfectly.
-    // 2. "IS-GPS-200N, Table 20-XIV. Parity Encoding Equations" is essential reading if you do want to understand what's going on here.
-    // 3. Variable names the same as "IS-GPS-200N, Table 20-XIV. Parity Encoding Equations" to make it easier to follow along
-
-    // Prepend 2 LSBs of the previous transmitted word to this word to form "source"
-    unsigned long source = *word | ((*previousWord << 30) & 0xC0000000UL);
-
-    // Masking source so we have just b1 --> b24
-    unsigned long d = source & 0x3FFFFFC0UL;
-
-    // Accessing D29 and D30 from previous word.
-    unsigned long d29Star = (source >> 31) & 0x1UL;
-    unsigned long d30Star = (source >> 30) & 0x1UL;
-
-    // The following graciously provided by gps-sdr-sim. Values can be calculated from "IS-GPS-200N, Table 20-XIV. Parity Encoding Equations"
-	unsigned long parityBitMasks[6] = { 
-		0x3B1F3480UL,
-        0x1D8F9A40UL,
-        0x2EC7CD00UL,
-		0x1763E680UL,
-        0x2BB1F340UL,
-        0x0B7A89C0UL
-    };
-
-    // If instructed, solve non-information bearing bits 23 and 24 to preserve parity check.
-    // This is required for words 2 and 10 of each subframe. See comments in "generateNavmessageBoilerplate".
-    // See later comments for an explanation of what's going on here.
-    if (solveNibs) {        
-        if ((d30Star + countSetBits(parityBitMasks[4] & d)) & 1UL) {
-            d ^= (1UL << 6);
-        }
-
-        if ((d29Star + countSetBits(parityBitMasks[5] & d)) & 1UL) {
-            d ^= (1UL << 7);
-        }
-	}
-
-    unsigned long D = d;
-
-    // The following XORs b1 --> b24 with d30Star (word XOR D30Star will just be word when D30Star is 0)
-    if (d30Star) {
-        D ^= 0x3FFFFFC0UL;
+// Simulation time is kept as a whole number of samples since the simulation epoch. This converts it back to GPS time.
+// NOTES:
+// 1. Only called at window, block and NAV frame boundaries. Nothing in the sample loops does time arithmetic.
+// 2. Whole seconds are split off with integer maths, so boundaries stay exact however long the simulation runs.
+//    Accumulating the sample interval with timeadd() drifts by a little every sample.
+// 3. Assumes a whole number of samples per second (see finaliseScenario())
+gtime_t sampleTime(gtime_t epoch, uint64_t sampleIndex) {
+    gtime_t time = epoch;
+
+    time.time += (time_t)(sampleIndex / Scenario.sampleRate_Hz);
+    time.sec += ((double)(sampleIndex % Scenario.sampleRate_Hz) / Scenario.sampleRate_Hz);
+
+    if (time.sec >= 1.0) {
+        time.time++;
+        time.sec -= 1.0;
     }
 
-    // The following lines compute and insert the 6 parity bits at the end of the word.
-    // STEPS:
-    // 1. Mask b so we're just looking at the relevant message bits (word & parityBitMasks[i])
-    // 2. Count total "set" (1) bits between masked word and DxStar (dxStar + countSetBits(y))
-    // 3. Modulo 2 the previous step's result (& 1UL). "& 1UL" = "% 2"! It's a performance thing (Ref: https://mziccard.me/2015/05/08/modulo-and-division-vs-bitwise-operations/)
-    // 4. Shift the computer parity bit into the correct location in word
-    // For why we use steps 2 and 3, see here: https://stackoverflow.com/questions/32747229/fastest-way-to-xor-all-bits-from-value-based-on-bitmask
-    D |= ((d29Star + countSetBits(d & parityBitMasks[0])) & 1UL) << 5;
-    D |= ((d30Star + countSetBits(d & parityBitMasks[1])) & 1UL) << 4;
-    D |= ((d29Star + countSetBits(d & parityBitMasks[2])) & 1UL) << 3;
-    D |= ((d30Star + countSetBits(d & parityBitMasks[3])) & 1UL) << 2;
-    D |= ((d30Star + countSetBits(d & parityBitMasks[4])) & 1UL) << 1;
-    D |= ((d29Star + countSetBits(d & parityBitMasks[5])) & 1UL);
-
-    D &= 0x3FFFFFFFUL;
-
-    *previousWord = D;
-    *word = D;
+    return time;
 }
 
-unsigned long updateTOW(unsigned long* tow_epochs, int* wn, double timeStep_s) {
-    // Cast tow to unsigned to make the operation easier
-    long workingTow_epochs = (signed)(*tow_epochs);
-
-    // Convert timeStep_s to timeStep_epochs
-    long timeStep_epochs = (signed)(timeStep_s / SUBFRAME_DURATION_S);
-
-    // Add timeStep_epochs to tow_epochs
-    workingTow_epochs += timeStep_epochs;
+// Round a duration to the nearest whole number of samples
+uint64_t secondsToSamples(double duration_s) {
+    return (uint64_t)llround(duration_s * Scenario.sampleRate_Hz);
+}
 
-    // Wrap around if result crosses the week boundary (Ref: IS-GPS-200N: 3.3.4 GPS Time and SV Z-Count)
-    if (workingTow_epochs > 100799) {
-        workingTow_epochs -= 100799;
-        *wn += 1;
-    }
-    
-    else if (workingTow_epochs < 0) {
-        workingTow_epochs += 100799;
-        *wn -= 1;
+// Find a PRN's C/A code in the tables generated at build time (see tools/ca-code-tables-generator.c).
+// Returns NULL if there isn't one (GPS, SBAS and QZSS PRNs are covered).
+const uint64_t* caCodeSequence(int prn) {
+    if ((prn < 0) || (prn > CA_CODE_TABLE_MAX_PRN) || (caCodeTableRows[prn] < 0)) {
+        return NULL;
     }
 
-    // Cast and assign the updated value
-    *tow_epochs = (unsigned)workingTow_epochs;
+    return caCodeTables[caCodeTableRows[prn]];
 }
 
-
-void generateNAVFrame(gtime_t initalTime, unsigned long* previousWord, unsigned long frame[SUBFRAME_COUNT][WORD_COUNT], bool init) {
-    int wn;
-    double tow_s = time2gpst(initalTime, &wn);
-
-    // NOTES:
-    // 1. Convert tow_s to TOW by dividing by TOW epoch duration
-    // 2. See IS-GPS-200N: 20.3.3.2 Handover Word (HOW) and IS-GPS-200N: 3.3.4 GPS Time and SV Z-Count
-    unsigned long tow_epochs = (unsigned)(tow_s / SUBFRAME_DURATION_S);
-    unsigned long navmessageWn;
-
-    // The last word of the previous frame is required to generate the parity bits for this frame
-    // We must generate the last word of the previous frame if one is not available (occurs on init)
-    if (init) {
-        for (short word = 0; word < WORD_COUNT; word++) {
-            // Insert TOW into the HOW (2nd word of subframe)
-			if (word == 1) {
-                frame[4][word] |= (tow_epochs << 13);
-            }
-            
-            // solveNibs = "true" when looking at either the 2nd or 10th word.
-            computeParity(&frame[4][word], previousWord, ((word == 1) || (word == 9)));
-        }
+// Pick how far ahead to fit an SV's pseudorange model (see GEOMETRY_ defines)
+// NOTE: A quadratic through three samples T apart is out by no more than about (jerk * T^3 / 16) in between them
+static double geometryUpdateInterval(const SV* sv, double windowDuration_s) {
+    // Stick to single windows until there's a jerk estimate
+    if (sv->psuedorangeJerk_msss < 0) {
+        return windowDuration_s;
     }
 
-    for (short subframe = 0; subframe < SUBFRAME_COUNT; subframe++) {
-        // Increment the TOW between subframes
-        updateTOW(&tow_epochs, &wn, SUBFRAME_DURATION_S);
+    double interval_s = GEOMETRY_UPDATE_MAX_INTERVAL_S;
 
-        // Mask TOW and WN for safety
-        tow_epochs = tow_epochs & BITMASK(17);
-        navmessageWn = wn & BITMASK(10);
+    if (sv->psuedorangeJerk_msss > 0) {
+        interval_s = fmin(interval_s, cbrt((16 * GEOMETRY_ERROR_BUDGET_CYCLES * CARRIER_WAVELENGTH_M) / sv->psuedorangeJerk_msss));
+    }
 
-        for (short word = 0; word < WORD_COUNT; word++) {
-            // Add Transmission Week Number to the third word of subframe one.
-			if ((subframe == 0) && (word == 2)) {
-                frame[subframe][word] |= (navmessageWn << 20);
-            }
+    interval_s = fmin(interval_s, (GEOMETRY_UPDATE_MAX_GROWTH * sv->psuedorangeSampleSpacing_s[1]));
 
-			// Insert TOW into the HOW (2nd word of subframe).
-			if (word == 1) {
-                frame[subframe][word] |= (tow_epochs << 13);
-            }
-            
-            // solveNibs = "true" when looking at either the 2nd or 10th word.
-            computeParity(&frame[subframe][word], previousWord, ((word == 1) || (word == 9)));
-        }
-    }
+    // Updates can only happen at the start of a window
+    return fmax(1.0, floor(interval_s / windowDuration_s)) * windowDuration_s;
 }
 
-// Recommended reading for understanding this function:
-// 1. IS-GPS-200N, 3.2.1.3 C/A-Code
-// 2. IS-GPS-200N, 3.3.2.3 C/A-Code Generation
-// 3. https://dsp.stackexchange.com/questions/52810/gps-coarse-acquisition-prn-codes
-// 4. https://www.wasyresearch.com/generating-gps-l1-c-a-pseudo-random-noise-prn-code-with-matlab-and-c-c/
-void generateCACodeSequence(char caCodeSequence[CA_CODE_SEQUENCE_LENGTH], char prn) {
-    // (Ref: IS-GPS-200N, Table 3-Ia. Code Phase Assignments)
-    short delays[] = {  5,   6,   7,   8,  17,  18, 139, 140, 141, 251,
-                        252, 254, 255, 256, 257, 258, 469, 470, 471, 472,
-                        473, 474, 509, 512, 513, 514, 515, 516, 859, 860,
-                        861, 862    };
-    
-    char g1[CA_CODE_SEQUENCE_LENGTH];
-    char g2i[CA_CODE_SEQUENCE_LENGTH];
-    char gi[CA_CODE_SEQUENCE_LENGTH];
+// Refit the quadratic pseudorange model of each SV that is due one at simulationTime (or every SV if force is set).
+// NOTES:
+// 1. The model passes through the pseudoranges at the SV's last fit, at simulationTime and at the next fit, which is
+//    picked by geometryUpdateInterval(). The first two are kept from earlier fits, so a tracked SV only needs one orbit
+//    evaluation per update, and low-dynamics SVs are only updated every few seconds.
+// 2. If the SV's samples don't end at simulationTime (first use, a forced update, or it hasn't been updated for a while)
+//    a new sample is taken one window before simulationTime instead.
+// 3. position_ecef and elevation_rad are left at the newest sample, i.e. when the next update is due.
+// 4. Every orbit evaluation needed is worked out first and then done in one batch (see orbits.c).
+// TODO: Update this to include ionoshperic (+ other?) effects
+void updateSatellitePositions(gtime_t simulationTime, SV** svs, short svCount, double* receiverPosition_ecef, double windowDuration_s, bool force) {
+    // Where each SV's new samples will be in the batch (-1 for samples that are carried on, or SVs not being updated)
+    int evaluations[svCount][3];
 
-    char g1Register[10];
-    char g2iRegister[10];
+    orbitBatchClear(Orbits);
 
-    // i and j declared here to save recreating them for each loop
-    short i, j;
+    for (int sv = 0; sv < svCount; sv++) {
+        double* samples_m = svs[sv]->psuedorangeSamples_m;
+        double* spacing_s = svs[sv]->psuedorangeSampleSpacing_s;
 
-    // Initialize the registers
-    for (i = 0; i < CA_REGISTER_LENGTH; i++) {
-        // By initializing the registers with -1, multiplying their bits later gives us the desired effect of modulo 2 addition (i.e. XOR)!
-        g1Register[i] = -1;
-        g2iRegister[i] = -1;
-    }
+        bool due = (timediff(simulationTime, svs[sv]->psuedorangeSampleTime) > (-0.5 * Scenario.sampleInterval_s));
 
-    // Generate the g1 and g2i sequences
-    for (i = 0; i < CA_CODE_SEQUENCE_LENGTH; i++) {
-        // Save the register outputs
-        g1[i] = g1Register[9];
-        g2i[i] = g2iRegister[9];
+        evaluations[sv][0] = evaluations[sv][1] = evaluations[sv][2] = -1;
 
-        // Calculate the feedback values
-        char c1 = g1Register[2] * g1Register[9];
-        char c2 = g2iRegister[1] * g2iRegister[2] * g2iRegister[5] * g2iRegister[7] * g2iRegister[8] * g2iRegister[9];
+        if (!due && !force) {
+            continue;
+        }
 
-        // Shift each of the bits one position to the right
-        for (short j = (CA_REGISTER_LENGTH - 1); j > 0; j--) {
-            g1Register[j] = g1Register[j - 1];
-            g2iRegister[j] = g2iRegister[j - 1];
+        // Carry the samples on from the last fit if they line up with this one
+        if (fabs(timediff(simulationTime, svs[sv]->psuedorangeSampleTime)) < (0.5 * Scenario.sampleInterval_s)) {
+            samples_m[0] = samples_m[1];
+            samples_m[1] = samples_m[2];
+            spacing_s[0] = spacing_s[1];
         }
 
-        // Shift the feedback values into each of the registers
-        g1Register[0] = c1;
-        g2iRegister[0] = c2;
-    }
+        else {
+            evaluations[sv][0] = orbitBatchAdd(Orbits, svs[sv]->orbitIndex, timeadd(simulationTime, -windowDuration_s));
+            evaluations[sv][1] = orbitBatchAdd(Orbits, svs[sv]->orbitIndex, simulationTime);
+            spacing_s[0] = windowDuration_s;
+            spacing_s[1] = windowDuration_s;
+        }
 
-    // Calculate the C/A Code Sequence!
-    // Start by defining two indicies, i and j.
-    // i starts at 0 as it is used to index the G1 code.
-    // j is delayed "delay[prn - 1]" chips behind i in the previous cycle.
-    for (i = 0, j = (CA_CODE_SEQUENCE_LENGTH - delays[prn - 1]); i < CA_CODE_SEQUENCE_LENGTH; i++, j++) {
-        // We wish to perform G1 XOR G2i (delayed).
-        // Multiplying G1 by G2i can give 1 or -1. Taking this from 1 we get either 0 or 2. We divide by 2 to get either 0 or 1 (desired).
-        // j % CA_CODE_SEQUENCE_LENGTH ensures j will wrap back to zero when it crosses the sequence boundary.
-        caCodeSequence[i] = (1 - g1[i] * g2i[j % CA_CODE_SEQUENCE_LENGTH]) / 2;
+        spacing_s[1] = geometryUpdateInterval(svs[sv], windowDuration_s);
+        svs[sv]->psuedorangeSampleTime = timeadd(simulationTime, spacing_s[1]);
+        evaluations[sv][2] = orbitBatchAdd(Orbits, svs[sv]->orbitIndex, svs[sv]->psuedorangeSampleTime);
     }
-}
 
-// TODO: Update this to include ionoshperic (+ other?) effects
-void updateSatellitePositions(gtime_t simulationTime, SV** svs, short svCount, double* receiverPosition_ecef, double timeStep_s) {
-    double receiverPosition_llh[3];
-    double lineOfSightVector_ecef[3];
-    double azimuthElevation_rad[2];
-    
-    double psuedorange_m;
-    double psuedorangeRate_ms;
+    propagateOrbits(Orbits, receiverPosition_ecef);
 
     for (int sv = 0; sv < svCount; sv++) {
-        // Critical check to prevent **MASSIVE** initial pseudorange rates which **WILL** completly mess up channel navbit and code chip pointers otherwise!
-        if (svs[sv]->psuedorange_m == 0) {
-            // Use the imagined previous time step
-            gtime_t previousSimulationTime = timeadd(simulationTime, -timeStep_s);
+        double* samples_m = svs[sv]->psuedorangeSamples_m;
+        double* spacing_s = svs[sv]->psuedorangeSampleSpacing_s;
+        int newest = evaluations[sv][2];
 
-            // Find previous satellite position in the ECEF frame
-            eph2pos(previousSimulationTime, &svs[sv]->ephemeris, svs[sv]->position_ecef, &svs[sv]->clockBias_s, &svs[sv]->variance);
+        if (newest < 0) {
+            continue;
+        }
 
-            // Find the previous satellite-receiver pseudorange
-            svs[sv]->psuedorange_m = geodist(svs[sv]->position_ecef, receiverPosition_ecef, lineOfSightVector_ecef);
+        for (int sample = 0; sample < 3; sample++) {
+            if (evaluations[sv][sample] >= 0) {
+                samples_m[sample] = Orbits->psuedorange_m[evaluations[sv][sample]];
+            }
         }
 
-        // Update satellite position in the ECEF frame (now using the current simulation time)
-        eph2pos(simulationTime, &svs[sv]->ephemeris, svs[sv]->position_ecef, &svs[sv]->clockBias_s, &svs[sv]->variance);
+        svs[sv]->position_ecef[0] = Orbits->position_ecef[0][newest];
+        svs[sv]->position_ecef[1] = Orbits->position_ecef[1][newest];
+        svs[sv]->position_ecef[2] = Orbits->position_ecef[2][newest];
+        svs[sv]->clockBias_s = Orbits->clockBias_s[newest];
 
-        // Calculate the current psuedorange
-        psuedorange_m = geodist(svs[sv]->position_ecef, receiverPosition_ecef, lineOfSightVector_ecef);
+        // Fit the model round simulationTime by divided differences (the samples needn't be evenly spaced)
+        double before_ms = ((samples_m[1] - samples_m[0]) / spacing_s[0]);
+        double after_ms = ((samples_m[2] - samples_m[1]) / spacing_s[1]);
+        double acceleration_mss = (2 * (after_ms - before_ms)) / (spacing_s[0] + spacing_s[1]);
 
-        // Calculate the new psuedorange rate
-        psuedorangeRate_ms = ((psuedorange_m - svs[sv]->psuedorange_m) / timeStep_s);
+        // Track how quickly the acceleration changes from one fit to the next
+        if (svs[sv]->psuedorangeFitTime.time != 0) {
+            double fitInterval_s = timediff(simulationTime, svs[sv]->psuedorangeFitTime);
 
-        // Use the reciever position (in llh) to find satellite azimuth and elevation
-        ecef2pos(receiverPosition_ecef, receiverPosition_llh);
-        satazel(receiverPosition_llh, lineOfSightVector_ecef, azimuthElevation_rad);
+            if (fitInterval_s > 0) {
+                svs[sv]->psuedorangeJerk_msss = fabs(acceleration_mss - svs[sv]->psuedorangeAcceleration_mss) / fitInterval_s;
+            }
+        }
 
-        // Update the current psuedorange, rate and elevation
-        svs[sv]->psuedorange_m = psuedorange_m;
-        svs[sv]->psuedorangeRate_ms = psuedorangeRate_ms;
-        svs[sv]->elevation_rad = azimuthElevation_rad[1];
+        svs[sv]->psuedorange_m = samples_m[1];
+        svs[sv]->psuedorangeRate_ms = before_ms + (0.5 * acceleration_mss * spacing_s[0]);
+        svs[sv]->psuedorangeAcceleration_mss = acceleration_mss;
+        svs[sv]->psuedorangeFitTime = simulationTime;
+        svs[sv]->elevation_rad = Orbits->elevation_rad[newest];
+
+        GeometryUpdateCount++;
     }
 }
 
+// Evaluate an SV's pseudorange model at a given time, optionally giving the pseudorange rate as well
+double psuedorangeAt(const SV* sv, gtime_t time, double* psuedorangeRate_ms) {
+    double t = timediff(time, sv->psuedorangeFitTime);
+
+    if (psuedorangeRate_ms) {
+        *psuedorangeRate_ms = sv->psuedorangeRate_ms + (sv->psuedorangeAcceleration_mss * t);
+    }
+
+    return sv->psuedorange_m + (sv->psuedorangeRate_ms * t) + (0.5 * sv->psuedorangeAcceleration_mss * t * t);
+}
+
 int compareSatelliteVisibility(const void *p1, const void *p2) {
     const SV *q1 = *(const SV **)p1;
     const SV *q2 = *(const SV **)p2;
@@ -446,28 +366,24 @@ int compareSatelliteVisibility(const void *p1, const void *p2) {
     return 0;
 }
 
-void updateChannelAllocations(gtime_t simulationTime, Channel channels[CHANNEL_COUNT], SV** svs, short svCount, double* receiverPosition_ecef, double timeStep_s) {
-    // Reset all the satellite pseudorange rates. Critical to prevent **MASSIVE** pseudorange rate errors
-    for (int i = 0; i < svCount; i++) {
-        svs[i]->psuedorangeRate_ms = 0;
-    }
-
+void updateChannelAllocations(gtime_t simulationTime, Channel* channels, int channelCount, SV** svs, short svCount, double* receiverPosition_ecef, double timeStep_s) {
     // Determine all sv positions
-    updateSatellitePositions(simulationTime, svs, svCount, receiverPosition_ecef, timeStep_s);
+    // NOTE: SVs that weren't in a channel have stale pseudorange samples, so get fitted from scratch (see updateSatellitePositions())
+    updateSatellitePositions(simulationTime, svs, svCount, receiverPosition_ecef, timeStep_s, true);
 
     // Rank satellites by distance from the receiver's sky center
     qsort(svs, svCount, sizeof(SV*), compareSatelliteVisibility);
 
     // Assign satellites to channels by most to least visible
-    for (int i = 0; i < CHANNEL_COUNT; i++) {
+    for (int i = 0; i < channelCount; i++) {
         // Assign the next most visible satellite in the svs list
         channels[i].sv = svs[i];
 
-        // Generate initial navframe
-        generateNAVFrame(simulationTime, &channels[i].previousWord, channels[i].sv->navFrame, true);
+        // Start a navframe. Its subframes are generated as they're reached (see navmessage.c)
+        startNAVFrame(&channels[i], simulationTime);
 
         // Determine the code and carrier frequencies and phases
-        updateChannelProperties(&channels[i], 1);
+        updateChannelProperties(simulationTime, &channels[i], 1);
 
         // Calculate the difference in expected transmission delay
         double codePhase_s = (channels[i].sv->psuedorange_m / LIGHTSPEED);
@@ -482,6 +398,9 @@ void updateChannelAllocations(gtime_t simulationTime, Channel channels[CHANNEL_C
 
         // Advance the channel modulation to the appropriate starting bit and chip
         advanceChannelModulation(&channels[i], simulationTime, (tow + codePhase_s), true);
+
+        // Start the fixed-point NCOs from the same place
+        loadChannelNCO(&channels[i]);
     }
 }
 
@@ -499,7 +418,7 @@ void updateRecieverPosition(double* receiverPosition_llh, double* receiverPositi
 }
 
 // NOTE: This may look a little funky. The goal was to provide a single function to update the channel modulation to ease comprehension.
-//       It is **REALLLY** slow when called with totalIncrement_s values >> CA_CODE_SEQUENCE_LENGTH. This is an accepted tradeoff for now.
+//       On init the increment can be most of a week, so the chip and navbit are worked out directly rather than pecked at.
 void advanceChannelModulation(Channel* channel, gtime_t simulationTime, double totalIncrement_s, bool init) {
     // Update the carrier phase
     channel->carrierPhase_cycles += channel->carrierDopplerShift_Hz * totalIncrement_s;
@@ -517,6 +436,22 @@ void advanceChannelModulation(Channel* channel, gtime_t simulationTime, double t
     // Convert increment in seconds to chips, factoring in channel's code freqeuncy (affected by Doppler)
     double totalIncrement_chips = (totalIncrement_s * channel->codeFrequency_Hz);
 
+    // Nothing needs generating on the way to the starting bit and chip, so jump straight there
+    if (init) {
+        double navBitLength_chips = (CA_CODE_SEQUENCE_LENGTH * CA_CYCLES_PER_NAV_BIT);
+        double codeChipPointer = (channel->codeChipPointer + totalIncrement_chips);
+        double navBitIncrement = floor(codeChipPointer / navBitLength_chips);
+
+        channel->codeChipPointer = (codeChipPointer - (navBitIncrement * navBitLength_chips));
+        channel->navBitPointer = (int)((channel->navBitPointer + (long)navBitIncrement) % FRAME_BIT_COUNT);
+        channel->codeChip = packedBit(channel->sv->caCode, (int)fmod(channel->codeChipPointer, CA_CODE_SEQUENCE_LENGTH));
+
+        generateNAVSubframe(channel, (channel->navBitPointer / SUBFRAME_BIT_COUNT));
+        channel->navBit = packedBit(channel->sv->navBitStream, channel->navBitPointer);
+
+        return;
+    }
+
     // Peck away at totalIncrement_chips in such away that we don't miss an instance when the navBitPointer should be incremented
     while (totalIncrement_chips > 0) {
         // Determine the maximum number of chips we can increment by this iteration
@@ -527,47 +462,79 @@ void advanceChannelModulation(Channel* channel, gtime_t simulationTime, double t
 
         // Update the code chip pointer and code chip
         channel->codeChipPointer += partialIncrement_chips;
-        channel->codeChip = channel->sv->caCodeSequence[(int)fmod(channel->codeChipPointer, CA_CODE_SEQUENCE_LENGTH)];
+        channel->codeChip = packedBit(channel->sv->caCode, (int)fmod(channel->codeChipPointer, CA_CODE_SEQUENCE_LENGTH));
         
         // Decide if the code chip pointer needs wrapping round
         if (channel->codeChipPointer >= (CA_CODE_SEQUENCE_LENGTH * CA_CYCLES_PER_NAV_BIT)) {
             channel->codeChipPointer -= (CA_CODE_SEQUENCE_LENGTH * CA_CYCLES_PER_NAV_BIT);
-            channel->navBitPointer++;
-            
-            // If we've gone past the last bit of this NAV frame...
-            if ((channel->navBitPointer % (SUBFRAME_COUNT * WORD_COUNT * WORD_BIT_COUNT)) == 0) {
-                channel->navBitPointer = 0;
-
-                // This check allows us to initilize the simulation more than a frame's worth of time (6 s) into the week
-                if (!init) {
-                    // Generate the next NAV frame!
-                    memcpy(channel->sv->navFrame, channel->sv->navFrameBoilerPlate, sizeof(channel->sv->navFrameBoilerPlate));
-                    generateNAVFrame(simulationTime, &(channel->previousWord), channel->sv->navFrame, false);
-                }
-            }
-
-            // Get the next NAV frame bit
-            short subframe = channel->navBitPointer / (WORD_COUNT * WORD_BIT_COUNT);
-            short word = (channel->navBitPointer % (WORD_COUNT * WORD_BIT_COUNT)) / WORD_BIT_COUNT;
-            short bit = channel->navBitPointer % WORD_BIT_COUNT;
 
-            channel->navBit = (channel->sv->navFrame[subframe][word] >> (29 - bit)) & 0x1;
+            // Get the next NAV frame bit, generating the next subframe if needed
+            advanceNavBit(channel, simulationTime);
         }
     }
 }
 
-void updateChannelProperties(Channel* channels, int channelCount) {
+// Gain for a channel carrying sv under the scenario's signal power model (see scenario.h)
+// NOTE: Power follows the sine of the elevation in dB, so it falls off quickest near the horizon
+static int32_t channelGain(const SV* sv) {
+    if (Scenario.signalPowerModel != SIGNAL_POWER_MODEL_ELEVATION) {
+        return CHANNEL_GAIN_UNITY;
+    }
+
+    double power_dB = -Scenario.signalPowerRange_dB * (1.0 - sin(fmax(sv->elevation_rad, 0.0)));
+    long gain = lround(pow(10.0, (power_dB / 20.0)) * CHANNEL_GAIN_UNITY);
+
+    // Never drop a channel altogether, and never go over unity (see CHANNEL_GAIN_FRACTION_BITS)
+    return (int32_t)((gain < 1) ? 1 : ((gain > CHANNEL_GAIN_UNITY) ? CHANNEL_GAIN_UNITY : gain));
+}
+
+// Set each channel's code and carrier frequencies for the window starting at simulationTime from its SV's pseudorange model.
+// NOTES:
+// 1. The floating-point frequencies are the model's mean over the window, so the float kernels land on the right phase at the end of it.
+// 2. The carrier NCO follows the model sample by sample. It starts at the model's rate half way through the first
+//    sample and the mixer adds the model's acceleration to the rate every sample (see mixer.c), so the phase it
+//    accumulates over the window is exactly the model's.
+// 3. The code NCO rate only changes by a fraction of its least significant bit per sample, so it is stepped once per
+//    synthesis block instead (see synthesis.c), starting from the model's rate half way through the first block.
+// 4. The rates are worked out again every window, so rounding in the steps never builds up. Only the SV's model
+//    needs refitting to follow the geometry, and that happens far less often (see updateSatellitePositions()).
+void updateChannelProperties(gtime_t simulationTime, Channel* channels, int channelCount) {
+    double blockDuration_s = (SYNTHESIS_BLOCK_SAMPLE_COUNT * Scenario.sampleInterval_s);
+    double windowDuration_s = (Scenario.windowSampleCount * Scenario.sampleInterval_s);
+
     for (int channel = 0; channel < channelCount; channel++) {
+        SV* sv = channels[channel].sv;
+
+        double psuedorangeRate_ms;
+        psuedorangeAt(sv, simulationTime, &psuedorangeRate_ms);
+
+        double meanPsuedorangeRate_ms = psuedorangeRate_ms + (0.5 * sv->psuedorangeAcceleration_mss * windowDuration_s);
+        double firstSamplePsuedorangeRate_ms = psuedorangeRate_ms + (0.5 * sv->psuedorangeAcceleration_mss * Scenario.sampleInterval_s);
+        double firstBlockPsuedorangeRate_ms = psuedorangeRate_ms + (0.5 * sv->psuedorangeAcceleration_mss * blockDuration_s);
+        double samplePsuedorangeRateStep_ms = (sv->psuedorangeAcceleration_mss * Scenario.sampleInterval_s);
+        double blockPsuedorangeRateStep_ms = (sv->psuedorangeAcceleration_mss * blockDuration_s);
+
         // Calculate the carrier Doppler shift
         // NOTE: See here for explanation: https://gnss-sdr.org/docs/sp-blocks/observables/#pseudorange-rate-measurement
-        channels[channel].carrierDopplerShift_Hz = -channels[channel].sv->psuedorangeRate_ms / CARRIER_WAVELENGTH_M;
-        channels[channel].codeDopplerShift_Hz = -channels[channel].sv->psuedorangeRate_ms / CA_CODE_WAVELENGTH_M;
+        channels[channel].carrierDopplerShift_Hz = -meanPsuedorangeRate_ms / CARRIER_WAVELENGTH_M;
+        channels[channel].codeDopplerShift_Hz = -meanPsuedorangeRate_ms / CA_CODE_WAVELENGTH_M;
 
         // Calculate the C/A Code Doppler shift
         // NOTE: This is only performed for the fundermental freqeuncy as the expected modulation bandwidth
         //       is ~24 MHz and the Doppler spread over this range should be limited
         channels[channel].codeFrequency_Hz = CA_CODE_FREQUENCY_HZ + channels[channel].codeDopplerShift_Hz;
 
+        // Convert the frequencies into fixed-point phase increments per sample for the NCO kernel
+        // NOTE: Negative Doppler shifts wrap round to the equivalent unsigned increment, which is what the carrier NCO wants
+        channels[channel].carrierRate_nco = (uint64_t)llround((-firstSamplePsuedorangeRate_ms / CARRIER_WAVELENGTH_M) * Scenario.sampleInterval_s * NCO_CARRIER_SCALE);
+        channels[channel].codeRate_nco = (uint64_t)llround((CA_CODE_FREQUENCY_HZ - (firstBlockPsuedorangeRate_ms / CA_CODE_WAVELENGTH_M)) * Scenario.sampleInterval_s * NCO_CODE_SCALE);
+
+        channels[channel].carrierRateStep_nco = llround((-samplePsuedorangeRateStep_ms / CARRIER_WAVELENGTH_M) * Scenario.sampleInterval_s * NCO_CARRIER_SCALE);
+        channels[channel].codeRateStep_nco = llround((-blockPsuedorangeRateStep_ms / CA_CODE_WAVELENGTH_M) * Scenario.sampleInterval_s * NCO_CODE_SCALE);
+
+        // Follow the SV's elevation as the geometry is refitted
+        channels[channel].gain = channelGain(sv);
+
         // TODO: Uncomment these lines to enable carrier phase measurements
         // Calculate carrier cycles between reciever and satellite
         // double carrierCycles = (channels[channel].sv->psuedorange_m / CARRIER_WAVELENGTH_M);
@@ -577,10 +544,41 @@ void updateChannelProperties(Channel* channels, int channelCount) {
     }
 }
 
-void simulate(void (*dumpCallback)(short*, int), eph_t* ephemerides, short svCount) {
+// Returns 0 once the whole duration has been output, or -1 if the simulation couldn't start or the output failed
+int simulate(OutputCallback dumpCallback, eph_t* ephemerides, short svCount, SimulationOptions* options) {
+    int channelCount = Scenario.channelCount;
+    int windowSampleCount = Scenario.windowSampleCount;
+
+    // Each channel is given a different SV (see updateChannelAllocations())
+    if (svCount < channelCount) {
+        printf("Error: %i channels but only %i SVs loaded. Set CHANNEL_COUNT to %i or fewer\n", channelCount, svCount, svCount);
+        return -1;
+    }
+
+    // Every SV needs a C/A code
+    for (int i = 0; i < svCount; i++) {
+        if (caCodeSequence(ephemerides[i].sat) == NULL) {
+            printf("Error: No C/A code for PRN %i\n", ephemerides[i].sat);
+            return -1;
+        }
+    }
+
+    // Only the NCO and TABLE kernels apply channel gains and noise
+    bool floatKernel = ((SYNTHESIS_KERNEL == SYNTHESIS_KERNEL_REFERENCE) || (SYNTHESIS_KERNEL == SYNTHESIS_KERNEL_BLOCK));
+
+    if (floatKernel && ((Scenario.signalPowerModel != SIGNAL_POWER_MODEL_FIXED) || (Scenario.noiseCN0_dBHz > 0))) {
+        printf("Error: SIGNAL_POWER_MODEL and NOISE_CN0_DBHZ need the NCO or TABLE synthesis kernel\n");
+        return -1;
+    }
+
+    // Buffer size multiplied by two as we need to record both and I and a Q value per sample
+    int iqBufferSize = (2 * windowSampleCount);
+
+    // Window length to the exact sample, so geometry updates land on window boundaries
+    double windowDuration_s = (windowSampleCount * Scenario.sampleInterval_s);
+
     SV svs[svCount];
-    Channel channels[CHANNEL_COUNT];
-    short iqBuffer[IQ_BUFFER_SIZE];
+    Channel channels[channelCount];
 
     SV** rankedSvs = (SV**)malloc(svCount * sizeof(*rankedSvs));
 
@@ -598,9 +596,30 @@ void simulate(void (*dumpCallback)(short*, int), eph_t* ephemerides, short svCou
     tow_s = ((unsigned long)ceil(tow_s) / (unsigned long)(SUBFRAME_DURATION_S * SUBFRAME_COUNT)) * (SUBFRAME_DURATION_S * SUBFRAME_COUNT);
 
     // Setup the time variables
-    gtime_t simulationTime = gpst2time(wn, tow_s);
-    gtime_t simulationEndTime = timeadd(simulationTime, SAMPLE_DURATION_S);
-    gtime_t visibilityUpdateTime = simulationTime;
+    // NOTE: Time is counted in samples from the start epoch (see sampleTime())
+    gtime_t simulationEpoch = gpst2time(wn, tow_s);
+    gtime_t simulationTime = simulationEpoch;
+
+    uint64_t sampleIndex = 0;
+    uint64_t endSampleIndex = secondsToSamples(Scenario.sampleDuration_s);
+    uint64_t visibilityUpdateSampleIndex = 0;
+
+    // I and Q values clipped to fit in a short, and how many windows had any
+    uint64_t saturatedCount = 0;
+    unsigned long saturatedWindowCount = 0;
+
+    // Build the NAV message parity tables
+    initNAVMessages();
+
+    // Pick the fastest synthesis code this CPU supports and start the synthesis threads
+    initSynthesis(options->threadCount, windowSampleCount, options->mixerName, options->noiseGeneratorName);
+
+    // Hand finished windows to a separate output thread so synthesis can get on with the next one
+    OutputPipeline* pipeline = outputPipelineCreate(dumpCallback, options->outputBufferCount, iqBufferSize, &options->outputFormat);
+    printf("OUTPUT BUFFERS: %i\n", options->outputBufferCount);
+    printf("OUTPUT FORMAT: %s (SCALE: %g | CLIP: %i)\n", outputFormatName(&options->outputFormat), options->outputFormat.scale, options->outputFormat.clipLevel);
+
+    printf("SCENARIO: %g MSPS | %i CHANNELS | %g S WINDOWS | %g S\n", Scenario.sampleFrequency_MSPS, channelCount, Scenario.iqSampleWindow_s, Scenario.sampleDuration_s);
 
     // Let the user know what start time was used
     printf("SIMULATION START TIME: %s (WN: %i | TOW: %i)\n", time_str(simulationTime, 0), wn, (unsigned int)tow_s);
@@ -617,6 +636,7 @@ void simulate(void (*dumpCallback)(short*, int), eph_t* ephemerides, short svCou
         // Set satellite ephemeris
         sv.ephemeris = *(ephemerides + i);
         sv.prn = sv.ephemeris.sat;
+        sv.orbitIndex = i;
 
         // Set the ephemeris to the simulation start time (ensures the simulation time is ahead of the last reported ephemeris time)
         sv.ephemeris.toe = simulationTime;
@@ -627,17 +647,37 @@ void simulate(void (*dumpCallback)(short*, int), eph_t* ephemerides, short svCou
         // Null the pseudorange and pseudorange rate
         sv.psuedorange_m = 0;
         sv.psuedorangeRate_ms = 0;
+        sv.psuedorangeAcceleration_mss = 0;
+        sv.psuedorangeFitTime = (gtime_t){ 0 };
+        sv.psuedorangeSampleTime = (gtime_t){ 0 };
+        sv.psuedorangeJerk_msss = -1;
 
         // Generate miscellaneous data
-        generateNAVFrameBoilerplate(sv.navFrameBoilerPlate, &sv.ephemeris);
-        memcpy(sv.navFrame, sv.navFrameBoilerPlate, sizeof(sv.navFrameBoilerPlate));
-        generateCACodeSequence(sv.caCodeSequence, sv.prn);
+        // NOTE: The NAV frame is encoded the first time one of its subframes is needed (see navmessage.c)
+        sv.navSubframesIode = -1;
+        sv.navSubframesWn = 0;
+        sv.caCode = caCodeSequence(sv.prn);
+        sv.codeTable = NULL;
 
         svs[i] = sv;
     }
 
+    // Put the ephemerides into batch form. Each SV can need up to three orbit evaluations per update.
+    const eph_t* orbitEphemerides[svCount];
+
+    for (int i = 0; i < svCount; i++) {
+        orbitEphemerides[i] = &svs[i].ephemeris;
+    }
+
+    Orbits = orbitBatchCreate(orbitEphemerides, svCount, (3 * svCount));
+
+    // Sample every SV's code at the output rate up front
+    if (SYNTHESIS_KERNEL == SYNTHESIS_KERNEL_TABLE) {
+        initCodeTables(svs, svCount);
+    }
+
     // Setup channels
-    for (char i = 0; i < CHANNEL_COUNT; i++) {
+    for (int i = 0; i < channelCount; i++) {
         Channel channel;
 
         channel.sv = NULL;
@@ -645,78 +685,112 @@ void simulate(void (*dumpCallback)(short*, int), eph_t* ephemerides, short svCou
         channel.codeDopplerShift_Hz = 0;
         channel.codeFrequency_Hz = 0;
         channel.carrierPhase_cycles = 0;
-        channel.previousWord = 0;
+        channel.navFrameTow_epochs = 0;
+        channel.navFrameWn = 0;
         channel.codeChip = 0;
         channel.navBit = 0;
         channel.codeChipPointer = 0;
         channel.navBitPointer = 0;
+        channel.carrierPhase_nco = 0;
+        channel.carrierRate_nco = 0;
+        channel.codePhase_nco = 0;
+        channel.codeRate_nco = 0;
+        channel.carrierRateStep_nco = 0;
+        channel.codeRateStep_nco = 0;
+        channel.gain = CHANNEL_GAIN_UNITY;
 
         channels[i] = channel;
     }
 
-    // Create progress bar
-    unsigned long steps = (SAMPLE_DURATION_S / IQ_SAMPLE_WINDOW_S);
-    progressbar *progress = progressbar_new("GENERATING IQ DATA...", steps);
+    // Time each stage of the loop, reporting as we go in place of a progress bar
+    // NOTE: The clock is read once between stages, starting here (see perfcounters.c)
+    PerfCounters counters;
+    initPerfCounters(&counters, &options->perfReport, (Scenario.sampleFrequency_MSPS * 1e6), endSampleIndex, options->outputBufferCount);
 
     // Perform simulation!
-    while (timediff(simulationEndTime, simulationTime) > 0) {
+    while (sampleIndex < endSampleIndex) {
+        simulationTime = sampleTime(simulationEpoch, sampleIndex);
+
         updateRecieverPosition(receiverPosition_llh, receiverPosition_ecef);
+        perfStageEnd(&counters, PERF_STAGE_RECEIVER);
 
         // Decide if it's time to update which satellites are in view
-        if (timediff(visibilityUpdateTime, simulationTime) <= 0) {
-            updateChannelAllocations(simulationTime, channels, rankedSvs, svCount, receiverPosition_ecef, IQ_SAMPLE_WINDOW_S);
+        if (sampleIndex >= visibilityUpdateSampleIndex) {
+            updateChannelAllocations(simulationTime, channels, channelCount, rankedSvs, svCount, receiverPosition_ecef, windowDuration_s);
 
             // Stage the next visibility update
-            visibilityUpdateTime = timeadd(visibilityUpdateTime, VISIBILITY_UPDATE_INTERVAL_S);
+            visibilityUpdateSampleIndex += secondsToSamples(Scenario.visibilityUpdateInterval_s);
+
+            perfStageEnd(&counters, PERF_STAGE_ALLOCATION);
         }
 
         // ...otherwise just update the visible satellite positions
         else {
-            updateSatellitePositions(simulationTime, rankedSvs, CHANNEL_COUNT, receiverPosition_ecef, IQ_SAMPLE_WINDOW_S);
+            updateSatellitePositions(simulationTime, rankedSvs, channelCount, receiverPosition_ecef, windowDuration_s, false);
 
             // Determine the code and carrier frequencies and phases
-            updateChannelProperties(channels, CHANNEL_COUNT);
+            updateChannelProperties(simulationTime, channels, channelCount);
+
+            perfStageEnd(&counters, PERF_STAGE_ORBITS);
         }
 
         // Uncomment the following for debugging
         // Dump the channel data
-        dumpChannels(simulationTime, channels, CHANNEL_COUNT);
+        dumpChannels(simulationTime, channels, channelCount);
+
+        // Leave the debug dump out of the stage times
+        perfStageBegin(&counters);
 
         // Fill sample window IQ buffer
-        for (int i = 0; i < IQ_BUFFER_SIZE; i += 2) {
-            short iAccumulated = 0;
-            short qAccumulated = 0;
-            int previousNavBitPointer = 0;
-            int carrierPhaseIndex = 0;
-
-            for (char channel = 0; channel < CHANNEL_COUNT; channel++) {
-                // Map the channel's carrier phase to an index in the carrier phase look-up table
-                // NOTE: Using look-up table to save processing time otherwise spent computing trig functions
-                carrierPhaseIndex = (int)(channels[channel].carrierPhase_cycles * (TRIG_TABLE_SIZE - 1));
-
-                // Write I followed by Q value to the buffer
-                // NOTES:
-                // 1. "((x * 2) - 1)" maps a 0/1 value to a -1/1 value. Multiplying these remapped terms allows us to XOR them
-                // 2. Multiplication by sine and cosine used to introduce carrier phase differences
-                iAccumulated += ((channels[channel].codeChip * 2) - 1) * ((channels[channel].navBit * 2) - 1) * cosTable[carrierPhaseIndex];
-                qAccumulated += ((channels[channel].codeChip * 2) - 1) * ((channels[channel].navBit * 2) - 1) * sinTable[carrierPhaseIndex];
-
-                // Advance the channel modulation to the appropriate starting bit and chip. May result in no change yet
-                advanceChannelModulation(&channels[channel], simulationTime, SAMPLE_INTERVAL_S, false);
-            }
+        short* iqBuffer = outputPipelineAcquire(pipeline);
+        perfStageEnd(&counters, PERF_STAGE_OUTPUT_WAIT);
 
-            iqBuffer[i] = iAccumulated;
-            iqBuffer[i + 1] = qAccumulated;
+        // NOTE: The reference path advances every channel one sample at a time. It is much slower and only kept for checking the block kernels against.
+        if (SYNTHESIS_KERNEL == SYNTHESIS_KERNEL_REFERENCE) {
+            synthesizeWindowReference(simulationEpoch, sampleIndex, channels, channelCount, iqBuffer, windowSampleCount);
+        }
 
-            simulationTime = timeadd(simulationTime, SAMPLE_INTERVAL_S);
+        else {
+            int windowSaturatedCount = synthesizeWindow(simulationEpoch, sampleIndex, channels, channelCount, iqBuffer, windowSampleCount);
+
+            if (windowSaturatedCount > 0) {
+                saturatedCount += windowSaturatedCount;
+                saturatedWindowCount++;
+            }
         }
 
-        dumpCallback(iqBuffer, IQ_BUFFER_SIZE);
+        perfStageEnd(&counters, PERF_STAGE_SYNTHESIS);
+
+        sampleIndex += windowSampleCount;
 
-        progressbar_inc(progress);
+        // NOTE: Without an output thread the window is output here. That's counted as output time, so the next window's timing starts after it.
+        outputPipelineSubmit(pipeline, iqBufferSize, simulationTime);
+        perfStageBegin(&counters);
+
+        perfWindowDone(&counters, windowSampleCount, outputPipelineDepth(pipeline), outputPipelineOutputTime_ns(pipeline));
+
+        // No point carrying on if the output can't take any more (e.g. the disk is full)
+        if (outputPipelineStopped(pipeline)) {
+            printf("Error: Output failed. Stopping simulation at %.3f s of %g s\n", (sampleIndex * Scenario.sampleInterval_s), Scenario.sampleDuration_s);
+            break;
+        }
     }
 
-    progressbar_finish(progress);
+    // Flush whatever is still queued before the caller closes the sink
+    outputPipelineFlush(pipeline);
+
+    perfFinish(&counters, outputPipelineOutputTime_ns(pipeline));
 
+    int result = outputPipelineStopped(pipeline) ? -1 : 0;
+    outputPipelineDestroy(pipeline);
+
+    printf("GEOMETRY UPDATES: %lu\n", GeometryUpdateCount);
+    printf("SATURATED IQ VALUES: %llu (IN %lu WINDOWS)\n", (unsigned long long)saturatedCount, saturatedWindowCount);
+
+    freeSynthesis();
+    freeCodeTables();
+    orbitBatchDestroy(Orbits);
     free(rankedSvs);
+
+    return result;
 }
\ No newline at end of file
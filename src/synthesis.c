@@ -0,0 +1,543 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "../libs/rtklib-2.4.3/src/rtklib.h"
+
+#include "../include/simulator.h"
+#include "../include/synthesis.h"
+#include "../include/mixer.h"
+#include "../include/noise.h"
+#include "../include/codetables.h"
+#include "../include/navmessage.h"
+#include "../include/threadpool.h"
+#include "../include/trig-tables.h"
+
+// Working memory for each synthesis thread
+// NOTE: Each thread mixes its share of the channels into its own partial buffers, which are summed once every thread has finished
+typedef struct {
+    int32_t* iPartial;
+    int32_t* qPartial;
+    int32_t signMask[SYNTHESIS_BLOCK_SAMPLE_COUNT];
+
+    // I and Q values saturated by this worker's slice of the last window (see reduceWindowTask())
+    int saturatedCount;
+} SynthesisWorker;
+
+// A window's worth of work for the synthesis threads
+typedef struct {
+    gtime_t epoch;
+    uint64_t windowStartSample;
+    Channel* channels;
+    int channelCount;
+    short* iqBuffer;
+    int sampleCount;
+} SynthesisJob;
+
+// NCO kernel state (see initSynthesis())
+// NOTE: With per-channel gains the accumulators carry CHANNEL_GAIN_FRACTION_BITS of fraction, which AccumulatorShift takes off again
+static ChannelMixer Mixer;
+static ChannelMixerFunction MixChannel;
+static ChannelMixerFunction MixChannelBlock;
+static int AccumulatorShift;
+
+// Noise added to the summed channels in the accumulators' units (see initSynthesis()). 0 for none.
+static NoiseGenerator Noise;
+static double NoiseSigma;
+static ThreadPool* Pool;
+static SynthesisWorker* Workers;
+static int WorkerCount;
+
+// Wrap the carrier phase back into the range advanceChannelModulation() keeps it in.
+// NOTES:
+// 1. A single sample never moves the phase by a whole cycle, so "phase - floor(phase)" is always "phase - 1" here
+//    and "phase + fabs(ceil(phase)) + 1" is always "phase + 1". The results are bit-identical to the reference path.
+static inline double wrapCarrierPhase(double carrierPhase_cycles) {
+    if (carrierPhase_cycles >= 1.0) {
+        return carrierPhase_cycles - 1.0;
+    }
+
+    else if (carrierPhase_cycles <= 0.0) {
+        return carrierPhase_cycles + 1.0;
+    }
+
+    return carrierPhase_cycles;
+}
+
+// XOR the channel's code chip and navbit into a sign mask: -1 (all bits set) when the sign is negative, 0 otherwise
+// NOTE: "(x ^ mask) - mask" then applies the sign without a multiply (see mixer.c)
+static inline int32_t channelSignMask(Channel* channel) {
+    return -(int32_t)(channel->codeChip ^ channel->navBit);
+}
+
+// Mix one channel into a block of interleaved IQ samples.
+// NOTES:
+// 1. Produces exactly the same samples and channel state as calling advanceChannelModulation() once per sample,
+//    but only does the chip, navbit and frame bookkeeping when a chip boundary is actually crossed.
+// 2. Between chip boundaries the code chip and navbit are fixed, so the sample loop only has to advance the
+//    carrier phase and code chip pointer.
+void synthesizeChannelBlock(Channel* channel, gtime_t epoch, uint64_t blockStartSample, short* iqBuffer, int sampleCount) {
+    // Computed with the same expressions as advanceChannelModulation() so the increments are bit-identical
+    double carrierIncrement_cycles = channel->carrierDopplerShift_Hz * Scenario.sampleInterval_s;
+    double codeIncrement_chips = Scenario.sampleInterval_s * channel->codeFrequency_Hz;
+
+    // Work on local copies so the compiler can keep them in registers
+    double carrierPhase_cycles = channel->carrierPhase_cycles;
+    double codeChipPointer = channel->codeChipPointer;
+    double nextChipBoundary = floor(codeChipPointer) + 1.0;
+    int32_t signMask = channelSignMask(channel);
+
+    int sample = 0;
+
+    while (sample < sampleCount) {
+        // Number of samples that can safely be produced before the next chip boundary.
+        // One sample of margin is left so rounding in the division can never step over a boundary unchecked.
+        double samplesToBoundary = ((nextChipBoundary - codeChipPointer) / codeIncrement_chips) - 1.0;
+        int runLength = (sampleCount - sample);
+
+        if (samplesToBoundary < runLength) {
+            runLength = (samplesToBoundary > 0) ? (int)samplesToBoundary : 0;
+        }
+
+        for (int i = 0; i < runLength; i++, sample++) {
+            int carrierPhaseIndex = (int)(carrierPhase_cycles * (TRIG_TABLE_SIZE - 1));
+
+            iqBuffer[(2 * sample)] += (TRIG_TABLE_COS(trigTable[carrierPhaseIndex]) ^ signMask) - signMask;
+            iqBuffer[(2 * sample) + 1] += (TRIG_TABLE_SIN(trigTable[carrierPhaseIndex]) ^ signMask) - signMask;
+
+            carrierPhase_cycles = wrapCarrierPhase(carrierPhase_cycles + carrierIncrement_cycles);
+            codeChipPointer += codeIncrement_chips;
+        }
+
+        if (sample == sampleCount) {
+            break;
+        }
+
+        // The next sample may cross a chip boundary so it gets the full treatment
+        int carrierPhaseIndex = (int)(carrierPhase_cycles * (TRIG_TABLE_SIZE - 1));
+
+        iqBuffer[(2 * sample)] += (TRIG_TABLE_COS(trigTable[carrierPhaseIndex]) ^ signMask) - signMask;
+        iqBuffer[(2 * sample) + 1] += (TRIG_TABLE_SIN(trigTable[carrierPhaseIndex]) ^ signMask) - signMask;
+
+        carrierPhase_cycles = wrapCarrierPhase(carrierPhase_cycles + carrierIncrement_cycles);
+        codeChipPointer += codeIncrement_chips;
+
+        if (codeChipPointer >= nextChipBoundary) {
+            channel->codeChip = packedBit(channel->sv->caCode, (int)fmod(codeChipPointer, CA_CODE_SEQUENCE_LENGTH));
+
+            // Decide if the code chip pointer needs wrapping round (see advanceChannelModulation())
+            if (codeChipPointer >= (CA_CODE_SEQUENCE_LENGTH * CA_CYCLES_PER_NAV_BIT)) {
+                codeChipPointer -= (CA_CODE_SEQUENCE_LENGTH * CA_CYCLES_PER_NAV_BIT);
+                advanceNavBit(channel, sampleTime(epoch, (blockStartSample + sample)));
+            }
+
+            nextChipBoundary = floor(codeChipPointer) + 1.0;
+            signMask = channelSignMask(channel);
+        }
+
+        sample++;
+    }
+
+    channel->carrierPhase_cycles = carrierPhase_cycles;
+    channel->codeChipPointer = codeChipPointer;
+}
+
+// Load the channel's NCO phases from its floating-point carrier phase and code chip pointer.
+// NOTE: Only needed when the channel is (re)allocated. From then on the NCO kernel keeps the fixed-point phases itself.
+void loadChannelNCO(Channel* channel) {
+    double carrierPhase_cycles = channel->carrierPhase_cycles - floor(channel->carrierPhase_cycles);
+
+    channel->carrierPhase_nco = (carrierPhase_cycles < 1.0) ? (uint64_t)(carrierPhase_cycles * NCO_CARRIER_SCALE) : 0;
+    channel->codePhase_nco = (uint64_t)(channel->codeChipPointer * NCO_CODE_SCALE);
+}
+
+// Fill a block with the channel's code chip and navbit sign for every sample, ready for the channel mixer (see mixer.h).
+// NOTES:
+// 1. Chip boundaries are found with integer maths, so the number of samples until the next one is exact and the
+//    code NCO only needs updating once per chip rather than once per sample.
+// 2. No floating-point or libm work is done in the sample loop.
+// 3. Always inlined, so the synthesis specialisations get copies with sampleCount folded in
+static inline __attribute__((always_inline)) void generateChannelSignMask(Channel* channel, gtime_t epoch, uint64_t blockStartSample, int32_t* signMask, int sampleCount) {
+    uint64_t codePhase = channel->codePhase_nco;
+    uint64_t codeRate = channel->codeRate_nco;
+    int32_t mask = channelSignMask(channel);
+
+    int sample = 0;
+
+    while (sample < sampleCount) {
+        // Number of samples until (and including) the one that takes the code NCO over the next chip boundary
+        uint64_t nextChipBoundary = ((codePhase >> NCO_CODE_FRACTION_BITS) + 1) << NCO_CODE_FRACTION_BITS;
+        uint64_t samplesToBoundary = ((nextChipBoundary - codePhase) + (codeRate - 1)) / codeRate;
+        int runLength = (sampleCount - sample);
+
+        if (samplesToBoundary < (uint64_t)runLength) {
+            runLength = (int)samplesToBoundary;
+        }
+
+        for (int i = 0; i < runLength; i++, sample++) {
+            signMask[sample] = mask;
+        }
+
+        codePhase += (runLength * codeRate);
+
+        if (codePhase >= nextChipBoundary) {
+            uint64_t chip = (codePhase >> NCO_CODE_FRACTION_BITS);
+
+            // Wrap round at the end of each navbit
+            if (chip >= (CA_CODE_SEQUENCE_LENGTH * CA_CYCLES_PER_NAV_BIT)) {
+                chip -= (CA_CODE_SEQUENCE_LENGTH * CA_CYCLES_PER_NAV_BIT);
+                codePhase -= ((uint64_t)(CA_CODE_SEQUENCE_LENGTH * CA_CYCLES_PER_NAV_BIT) << NCO_CODE_FRACTION_BITS);
+                advanceNavBit(channel, sampleTime(epoch, (blockStartSample + sample - 1)));
+            }
+
+            channel->codeChip = packedBit(channel->sv->caCode, (int)(chip % CA_CODE_SEQUENCE_LENGTH));
+            mask = channelSignMask(channel);
+        }
+    }
+
+    channel->codePhase_nco = codePhase;
+}
+
+// As generateChannelSignMask() but reading the code from the SV's code tables.
+// NOTE: The code NCO is still advanced exactly. It only decides where each run starts in the tables and where the navbit changes.
+static inline __attribute__((always_inline)) void generateChannelSignMaskTable(Channel* channel, gtime_t epoch, uint64_t blockStartSample, int32_t* signMask, int sampleCount) {
+    uint64_t navBitLength = ((uint64_t)(CA_CODE_SEQUENCE_LENGTH * CA_CYCLES_PER_NAV_BIT) << NCO_CODE_FRACTION_BITS);
+    uint64_t codePhase = channel->codePhase_nco;
+    uint64_t codeRate = channel->codeRate_nco;
+
+    int sample = 0;
+
+    while (sample < sampleCount) {
+        // Number of samples left before the code NCO goes over the end of the navbit
+        uint64_t samplesToNavBit = ((navBitLength - codePhase) + (codeRate - 1)) / codeRate;
+        int runLength = ((sampleCount - sample) < CODE_TABLE_MAX_RUN_SAMPLE_COUNT) ? (sampleCount - sample) : CODE_TABLE_MAX_RUN_SAMPLE_COUNT;
+
+        if (samplesToNavBit < (uint64_t)runLength) {
+            runLength = (int)samplesToNavBit;
+        }
+
+        generateCodeTableSignMask(channel->sv, codePhase, codeRate, channel->navBit, &signMask[sample], runLength);
+
+        codePhase += (runLength * codeRate);
+        sample += runLength;
+
+        if (codePhase >= navBitLength) {
+            codePhase -= navBitLength;
+            advanceNavBit(channel, sampleTime(epoch, (blockStartSample + sample - 1)));
+        }
+    }
+
+    channel->codePhase_nco = codePhase;
+    channel->codeChip = packedBit(channel->sv->caCode, (int)((codePhase >> NCO_CODE_FRACTION_BITS) % CA_CODE_SEQUENCE_LENGTH));
+}
+
+// Mix one channel into a block of 32-bit I and Q accumulators using the fixed-point NCOs.
+// NOTES:
+// 1. The code NCO runs first and leaves one sign per sample in signMask (scratch space of at least sampleCount entries).
+// 2. The carrier NCO and the actual mixing are done by the vectorised channel mixer picked in initSynthesis().
+// 3. Expects to be called once per SYNTHESIS_BLOCK_SAMPLE_COUNT samples, as the code NCO rate is stepped after every call.
+// 4. Always inlined with the mixer to use, so the synthesis specialisations get copies for whole blocks (see synthesizeChannels())
+static inline __attribute__((always_inline)) void synthesizeChannelBlockNCOBody(Channel* channel, gtime_t epoch, uint64_t blockStartSample, int32_t* iAccumulator, int32_t* qAccumulator, int32_t* signMask, int sampleCount, ChannelMixerFunction mixChannel) {
+    if (SYNTHESIS_KERNEL == SYNTHESIS_KERNEL_TABLE) {
+        generateChannelSignMaskTable(channel, epoch, blockStartSample, signMask, sampleCount);
+    }
+
+    else {
+        generateChannelSignMask(channel, epoch, blockStartSample, signMask, sampleCount);
+    }
+
+    mixChannel(iAccumulator, qAccumulator, signMask, &channel->carrierPhase_nco, &channel->carrierRate_nco, (uint64_t)channel->carrierRateStep_nco, channel->gain, sampleCount);
+
+    // The code rate changes far too little per sample to step every sample, so it moves on to the next block's (see updateChannelProperties())
+    channel->codeRate_nco += (uint64_t)channel->codeRateStep_nco;
+
+    // Keep the floating-point state up to date for debugging and reporting
+    channel->carrierPhase_cycles = (channel->carrierPhase_nco / NCO_CARRIER_SCALE);
+    channel->codeChipPointer = (channel->codePhase_nco / NCO_CODE_SCALE);
+}
+
+void synthesizeChannelBlockNCO(Channel* channel, gtime_t epoch, uint64_t blockStartSample, int32_t* iAccumulator, int32_t* qAccumulator, int32_t* signMask, int sampleCount) {
+    synthesizeChannelBlockNCOBody(channel, epoch, blockStartSample, iAccumulator, qAccumulator, signMask, sampleCount, MixChannel);
+}
+
+// Mix this worker's share of the channels (every WorkerCount'th one) into its partial buffers
+static void synthesizeChannelsTask(void* context, int worker, int workerCount) {
+    SynthesisJob* job = (SynthesisJob*)context;
+    SynthesisWorker* self = &Workers[worker];
+
+    memset(self->iPartial, 0, (job->sampleCount * sizeof(int32_t)));
+    memset(self->qPartial, 0, (job->sampleCount * sizeof(int32_t)));
+
+    // Nothing to do if there are more threads than channels
+    if (worker >= job->channelCount) {
+        return;
+    }
+
+    for (int block = 0; block < job->sampleCount; block += SYNTHESIS_BLOCK_SAMPLE_COUNT) {
+        int blockSampleCount = ((job->sampleCount - block) < SYNTHESIS_BLOCK_SAMPLE_COUNT) ? (job->sampleCount - block) : SYNTHESIS_BLOCK_SAMPLE_COUNT;
+        uint64_t blockStartSample = (job->windowStartSample + block);
+
+        for (int channel = worker; channel < job->channelCount; channel += workerCount) {
+            synthesizeChannelBlockNCO(&job->channels[channel], job->epoch, blockStartSample, &self->iPartial[block], &self->qPartial[block], self->signMask, blockSampleCount);
+        }
+    }
+}
+
+// Sum every worker's partial buffers over this worker's slice of the window, add any noise, then saturate and interleave the result into the output buffer
+// NOTE: Always inlined. With wholeBlocks the partial buffers are summed a block at a time, with the block length a
+//       compile-time constant, for the synthesis specialisations.
+static inline __attribute__((always_inline)) void reduceWindow(SynthesisJob* job, int worker, int workerCount, const bool wholeBlocks) {
+    int first = (int)(((long)job->sampleCount * worker) / workerCount);
+    int last = (int)(((long)job->sampleCount * (worker + 1)) / workerCount);
+
+    int32_t* iSum = Workers[0].iPartial;
+    int32_t* qSum = Workers[0].qPartial;
+
+    for (int partial = 1; partial < workerCount; partial++) {
+        int i = first;
+
+        if (wholeBlocks) {
+            for (; (i + SYNTHESIS_BLOCK_SAMPLE_COUNT) <= last; i += SYNTHESIS_BLOCK_SAMPLE_COUNT) {
+                for (int j = i; j < (i + SYNTHESIS_BLOCK_SAMPLE_COUNT); j++) {
+                    iSum[j] += Workers[partial].iPartial[j];
+                    qSum[j] += Workers[partial].qPartial[j];
+                }
+            }
+        }
+
+        for (; i < last; i++) {
+            iSum[i] += Workers[partial].iPartial[i];
+            qSum[i] += Workers[partial].qPartial[i];
+        }
+    }
+
+    if (NoiseSigma > 0) {
+        Noise.add(&iSum[first], &qSum[first], (job->windowStartSample + first), (uint32_t)Scenario.noiseSeed, NoiseSigma, (last - first));
+    }
+
+    Workers[worker].saturatedCount = Mixer.pack(&job->iqBuffer[(2 * first)], &iSum[first], &qSum[first], AccumulatorShift, (last - first));
+}
+
+static void reduceWindowTask(void* context, int worker, int workerCount) {
+    reduceWindow((SynthesisJob*)context, worker, workerCount, false);
+}
+
+// As reduceWindowTask(), for the synthesis specialisations. The sums don't depend on the channel count, so every entry shares it.
+static void reduceWindowBlocksTask(void* context, int worker, int workerCount) {
+    reduceWindow((SynthesisJob*)context, worker, workerCount, true);
+}
+
+// As synthesizeChannelsTask(), for a channel count known at compile time (see the specialisations below)
+// NOTE: Every whole block is mixed by a copy of the sign mask code built for exactly SYNTHESIS_BLOCK_SAMPLE_COUNT
+//       samples and by the mixer's whole block version. Only the window's last part block (if any) goes the generic way.
+static inline __attribute__((always_inline)) void synthesizeChannels(SynthesisJob* job, int worker, int workerCount, const int channelCount) {
+    SynthesisWorker* self = &Workers[worker];
+    int wholeBlockSampleCount = ((job->sampleCount / SYNTHESIS_BLOCK_SAMPLE_COUNT) * SYNTHESIS_BLOCK_SAMPLE_COUNT);
+
+    memset(self->iPartial, 0, (job->sampleCount * sizeof(int32_t)));
+    memset(self->qPartial, 0, (job->sampleCount * sizeof(int32_t)));
+
+    // Nothing to do if there are more threads than channels
+    if (worker >= channelCount) {
+        return;
+    }
+
+    for (int block = 0; block < wholeBlockSampleCount; block += SYNTHESIS_BLOCK_SAMPLE_COUNT) {
+        uint64_t blockStartSample = (job->windowStartSample + block);
+
+        for (int channel = worker; channel < channelCount; channel += workerCount) {
+            synthesizeChannelBlockNCOBody(&job->channels[channel], job->epoch, blockStartSample, &self->iPartial[block], &self->qPartial[block], self->signMask, SYNTHESIS_BLOCK_SAMPLE_COUNT, MixChannelBlock);
+        }
+    }
+
+    if (wholeBlockSampleCount < job->sampleCount) {
+        for (int channel = worker; channel < channelCount; channel += workerCount) {
+            synthesizeChannelBlockNCO(&job->channels[channel], job->epoch, (job->windowStartSample + wholeBlockSampleCount), &self->iPartial[wholeBlockSampleCount], &self->qPartial[wholeBlockSampleCount], self->signMask, (job->sampleCount - wholeBlockSampleCount));
+        }
+    }
+}
+
+// Specialisations of synthesizeChannelsTask() for common scenarios, picked by initSynthesis()
+// NOTES:
+// 1. Entries are matched on the scenario's sample rate and channel count as configured, never on values worked out
+//    from them, so a scenario is only reported as specialised if it really is one of these.
+// 2. The channel loop and the block length are compile-time constants. Nothing in the per-sample work depends on
+//    the sample rate, so the entries for one channel count share the same tasks.
+// 3. Anything not listed runs synthesizeChannelsTask(), which gives exactly the same output.
+#define SPECIALISED_SYNTHESIS_TASK(channels) \
+    static void synthesizeChannelsTask_##channels(void* context, int worker, int workerCount) { \
+        synthesizeChannels((SynthesisJob*)context, worker, workerCount, (channels)); \
+    }
+
+#define SPECIALISATION(msps, channels) \
+    { #msps " MSPS x " #channels " CHANNELS", ((msps) * 1000000ULL), (channels), synthesizeChannelsTask_##channels, reduceWindowBlocksTask }
+
+SPECIALISED_SYNTHESIS_TASK(8)
+SPECIALISED_SYNTHESIS_TASK(12)
+SPECIALISED_SYNTHESIS_TASK(16)
+
+typedef struct {
+    const char* name;
+    uint64_t sampleRate_Hz;
+    int channelCount;
+    ThreadPoolTask synthesizeTask;
+    ThreadPoolTask reduceTask;
+} SynthesisSpecialisation;
+
+static const SynthesisSpecialisation Specialisations[] = {
+    SPECIALISATION(2, 8),
+    SPECIALISATION(2, 12),
+    SPECIALISATION(2, 16),
+    SPECIALISATION(4, 8),
+    SPECIALISATION(4, 12),
+    SPECIALISATION(4, 16),
+    SPECIALISATION(8, 8),
+    SPECIALISATION(8, 12),
+    SPECIALISATION(8, 16),
+    SPECIALISATION(16, 8),
+    SPECIALISATION(16, 12),
+    SPECIALISATION(16, 16)
+};
+
+#define SPECIALISATION_COUNT (int)(sizeof(Specialisations) / sizeof(Specialisations[0]))
+
+static const SynthesisSpecialisation GenericSynthesis = { "GENERIC", 0, 0, synthesizeChannelsTask, reduceWindowTask };
+static const SynthesisSpecialisation* Specialisation = &GenericSynthesis;
+
+// Pick the channel mixer for this CPU, pick a specialisation for the scenario and start the synthesis threads.
+// Must be called before synthesizeWindow().
+// mixerName and noiseGeneratorName force a particular version (see findChannelMixer()). NULL picks the widest.
+// NOTES:
+// 1. The NCO kernel gives bit-identical output whatever the thread count, as every partial sum is an exact integer sum.
+// 2. The gain multiply is only built into the mixer when the scenario's signal power model needs it (see scenario.h)
+// 3. A full amplitude channel has carrier power TRIG_TABLE_AMPLITUDE^2, so N0 = C / (C/N0). Complex noise over the whole
+//    sample rate then has N0 * sampleRate of power, half of it in each of I and Q.
+void initSynthesis(int threadCount, int maxSampleCount, const char* mixerName, const char* noiseGeneratorName) {
+    bool gained = (Scenario.signalPowerModel != SIGNAL_POWER_MODEL_FIXED);
+
+    if (!mixerName || !findChannelMixer(mixerName, &Mixer)) {
+        Mixer = selectChannelMixer();
+    }
+
+    MixChannel = gained ? Mixer.mixGain : Mixer.mix;
+    MixChannelBlock = gained ? Mixer.mixGainBlock : Mixer.mixBlock;
+    AccumulatorShift = gained ? CHANNEL_GAIN_FRACTION_BITS : 0;
+
+    if (!noiseGeneratorName || !findNoiseGenerator(noiseGeneratorName, &Noise)) {
+        Noise = selectNoiseGenerator();
+    }
+
+    NoiseSigma = 0;
+
+    if (Scenario.noiseCN0_dBHz > 0) {
+        NoiseSigma = TRIG_TABLE_AMPLITUDE * sqrt(Scenario.sampleRate_Hz / (2.0 * pow(10.0, (Scenario.noiseCN0_dBHz / 10.0)))) * (1 << AccumulatorShift);
+    }
+
+    Specialisation = &GenericSynthesis;
+
+    for (int i = 0; i < SPECIALISATION_COUNT; i++) {
+        if ((Specialisations[i].sampleRate_Hz == Scenario.sampleRate_Hz) && (Specialisations[i].channelCount == Scenario.channelCount)) {
+            Specialisation = &Specialisations[i];
+        }
+    }
+
+    Pool = threadPoolCreate(threadCount);
+
+    // The pool may have started fewer threads than asked for
+    WorkerCount = threadPoolSize(Pool);
+    Workers = (SynthesisWorker*)calloc(WorkerCount, sizeof(SynthesisWorker));
+
+    for (int worker = 0; worker < WorkerCount; worker++) {
+        Workers[worker].iPartial = (int32_t*)malloc(maxSampleCount * sizeof(int32_t));
+        Workers[worker].qPartial = (int32_t*)malloc(maxSampleCount * sizeof(int32_t));
+    }
+
+    printf("CHANNEL MIXER: %s%s\n", Mixer.name, (gained ? " (WITH GAINS)" : ""));
+
+    if (NoiseSigma > 0) {
+        printf("NOISE GENERATOR: %s (C/N0: %g DB-HZ | SIGMA: %g | SEED: %i)\n", Noise.name, Scenario.noiseCN0_dBHz, (NoiseSigma / (1 << AccumulatorShift)), Scenario.noiseSeed);
+    }
+
+    printf("SYNTHESIS SPECIALISATION: %s\n", Specialisation->name);
+    printf("SYNTHESIS THREADS: %i\n", WorkerCount);
+}
+
+void freeSynthesis(void) {
+    threadPoolDestroy(Pool);
+
+    for (int worker = 0; worker < WorkerCount; worker++) {
+        free(Workers[worker].iPartial);
+        free(Workers[worker].qPartial);
+    }
+
+    free(Workers);
+}
+
+// Fill a window of interleaved IQ samples using the block kernels. The window starts windowStartSample samples after epoch.
+// Returns the number of I and Q values that had to be saturated to fit in a short.
+// NOTES:
+// 1. The NCO and TABLE kernels are spread over the synthesis threads. The float block kernel always runs on the calling thread.
+// 2. The float block kernel sums straight into the shorts like the reference kernel, so it doesn't saturate (or count) anything.
+int synthesizeWindow(gtime_t epoch, uint64_t windowStartSample, Channel* channels, int channelCount, short* iqBuffer, int sampleCount) {
+    if ((SYNTHESIS_KERNEL == SYNTHESIS_KERNEL_NCO) || (SYNTHESIS_KERNEL == SYNTHESIS_KERNEL_TABLE)) {
+        SynthesisJob job = { epoch, windowStartSample, channels, channelCount, iqBuffer, sampleCount };
+
+        // The specialisation is only for the channel count it was picked for
+        bool specialised = (channelCount == Specialisation->channelCount);
+
+        threadPoolRun(Pool, (specialised ? Specialisation->synthesizeTask : synthesizeChannelsTask), &job);
+        threadPoolRun(Pool, (specialised ? Specialisation->reduceTask : reduceWindowTask), &job);
+
+        int saturatedCount = 0;
+
+        for (int worker = 0; worker < WorkerCount; worker++) {
+            saturatedCount += Workers[worker].saturatedCount;
+        }
+
+        return saturatedCount;
+    }
+
+    for (int block = 0; block < sampleCount; block += SYNTHESIS_BLOCK_SAMPLE_COUNT) {
+        int blockSampleCount = ((sampleCount - block) < SYNTHESIS_BLOCK_SAMPLE_COUNT) ? (sampleCount - block) : SYNTHESIS_BLOCK_SAMPLE_COUNT;
+        short* blockBuffer = &iqBuffer[(2 * block)];
+
+        memset(blockBuffer, 0, (2 * blockSampleCount * sizeof(short)));
+
+        for (int channel = 0; channel < channelCount; channel++) {
+            synthesizeChannelBlock(&channels[channel], epoch, (windowStartSample + block), blockBuffer, blockSampleCount);
+        }
+    }
+
+    return 0;
+}
+
+// Fill a window of interleaved IQ samples one sample at a time.
+// NOTE: This is the original (slow) synthesis loop. It is kept as the reference the block kernel is checked against.
+void synthesizeWindowReference(gtime_t epoch, uint64_t windowStartSample, Channel* channels, int channelCount, short* iqBuffer, int sampleCount) {
+    for (int i = 0; i < (2 * sampleCount); i += 2) {
+        gtime_t simulationTime = sampleTime(epoch, (windowStartSample + (i / 2)));
+        short iAccumulated = 0;
+        short qAccumulated = 0;
+        int carrierPhaseIndex = 0;
+
+        for (int channel = 0; channel < channelCount; channel++) {
+            // Map the channel's carrier phase to an index in the carrier phase look-up table
+            // NOTE: Using look-up table to save processing time otherwise spent computing trig functions
+            carrierPhaseIndex = (int)(channels[channel].carrierPhase_cycles * (TRIG_TABLE_SIZE - 1));
+
+            // Write I followed by Q value to the buffer
+            // NOTES:
+            // 1. "((x * 2) - 1)" maps a 0/1 value to a -1/1 value. Multiplying these remapped terms allows us to XOR them
+            // 2. Multiplication by sine and cosine used to introduce carrier phase differences
+            iAccumulated += ((channels[channel].codeChip * 2) - 1) * ((channels[channel].navBit * 2) - 1) * TRIG_TABLE_COS(trigTable[carrierPhaseIndex]);
+            qAccumulated += ((channels[channel].codeChip * 2) - 1) * ((channels[channel].navBit * 2) - 1) * TRIG_TABLE_SIN(trigTable[carrierPhaseIndex]);
+
+            // Advance the channel modulation to the appropriate starting bit and chip. May result in no change yet
+            advanceChannelModulation(&channels[channel], simulationTime, Scenario.sampleInterval_s, false);
+        }
+
+        iqBuffer[i] = iAccumulated;
+        iqBuffer[i + 1] = qAccumulated;
+    }
+}
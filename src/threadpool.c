@@ -0,0 +1,143 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+#include "../include/threadpool.h"
+
+// A minimal fork/join pool. threadPoolRun() hands the same task to every thread and returns once they have all finished it.
+// NOTES:
+// 1. The calling thread does the work of worker 0, so a pool of N threads only starts (N - 1) extra threads.
+// 2. Threads sleep on a condition variable between tasks. "generation" counts tasks so a woken thread knows a new one is waiting.
+struct ThreadPool {
+    pthread_t* threads;
+    int threadCount;
+
+    pthread_mutex_t lock;
+    pthread_cond_t taskReady;
+    pthread_cond_t taskDone;
+
+    ThreadPoolTask task;
+    void* context;
+    unsigned long generation;
+    int busyCount;
+    bool stopping;
+};
+
+typedef struct {
+    ThreadPool* pool;
+    int worker;
+} ThreadPoolWorker;
+
+static void* threadPoolMain(void* argument) {
+    ThreadPoolWorker* self = (ThreadPoolWorker*)argument;
+    ThreadPool* pool = self->pool;
+    unsigned long seenGeneration = 0;
+
+    pthread_mutex_lock(&pool->lock);
+
+    while (true) {
+        // Wait for a new task (or to be told to stop)
+        while (!pool->stopping && (pool->generation == seenGeneration)) {
+            pthread_cond_wait(&pool->taskReady, &pool->lock);
+        }
+
+        if (pool->stopping) {
+            break;
+        }
+
+        seenGeneration = pool->generation;
+        pthread_mutex_unlock(&pool->lock);
+
+        pool->task(pool->context, self->worker, pool->threadCount);
+
+        pthread_mutex_lock(&pool->lock);
+
+        // Last one out lets threadPoolRun() return
+        if (--pool->busyCount == 0) {
+            pthread_cond_signal(&pool->taskDone);
+        }
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+    free(self);
+
+    return NULL;
+}
+
+ThreadPool* threadPoolCreate(int threadCount) {
+    ThreadPool* pool = (ThreadPool*)calloc(1, sizeof(ThreadPool));
+
+    pool->threadCount = (threadCount < 1) ? 1 : threadCount;
+    pool->threads = (pthread_t*)calloc(pool->threadCount, sizeof(pthread_t));
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->taskReady, NULL);
+    pthread_cond_init(&pool->taskDone, NULL);
+
+    // Worker 0 is the calling thread, so start from 1
+    for (int i = 1; i < pool->threadCount; i++) {
+        ThreadPoolWorker* worker = (ThreadPoolWorker*)malloc(sizeof(ThreadPoolWorker));
+        worker->pool = pool;
+        worker->worker = i;
+
+        if (pthread_create(&pool->threads[i], NULL, threadPoolMain, worker) != 0) {
+            printf("Error: Could not start worker thread %i\n", i);
+            free(worker);
+
+            // Carry on with the threads we did manage to start
+            pool->threadCount = i;
+            break;
+        }
+    }
+
+    return pool;
+}
+
+// Number of threads actually running (may be fewer than asked for if some could not be started)
+int threadPoolSize(ThreadPool* pool) {
+    return pool->threadCount;
+}
+
+void threadPoolRun(ThreadPool* pool, ThreadPoolTask task, void* context) {
+    if (pool->threadCount == 1) {
+        task(context, 0, 1);
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->task = task;
+    pool->context = context;
+    pool->busyCount = (pool->threadCount - 1);
+    pool->generation++;
+    pthread_cond_broadcast(&pool->taskReady);
+    pthread_mutex_unlock(&pool->lock);
+
+    task(context, 0, pool->threadCount);
+
+    pthread_mutex_lock(&pool->lock);
+
+    while (pool->busyCount > 0) {
+        pthread_cond_wait(&pool->taskDone, &pool->lock);
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+}
+
+void threadPoolDestroy(ThreadPool* pool) {
+    pthread_mutex_lock(&pool->lock);
+    pool->stopping = true;
+    pthread_cond_broadcast(&pool->taskReady);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (int i = 1; i < pool->threadCount; i++) {
+        pthread_join(pool->threads[i], NULL);
+    }
+
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->taskReady);
+    pthread_cond_destroy(&pool->taskDone);
+
+    free(pool->threads);
+    free(pool);
+}
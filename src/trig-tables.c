@@ -0,0 +1,519 @@
+#include <stdint.h>
+
+#include "../include/trig-tables.h"
+
+const int32_t trigTable[TRIG_TABLE_SIZE + 1] __attribute__((aligned(64))) = {
+	0x000000FA, 0x000000F9, 0x000000F9, 0x000100F9, 0x000100F9, 0x000100F9, 0x000200F9, 0x000200F9, 
+	0x000300F9, 0x000300F9, 0x000300F9, 0x000400F9, 0x000400F9, 0x000400F9, 0x000500F9, 0x000500F9, 
+	0x000600F9, 0x000600F9, 0x000600F9, 0x000700F9, 0x000700F9, 0x000800F9, 0x000800F9, 0x000800F9, 
+	0x000900F9, 0x000900F9, 0x000900F9, 0x000A00F9, 0x000A00F9, 0x000B00F9, 0x000B00F9, 0x000B00F9, 
+	0x000C00F9, 0x000C00F9, 0x000D00F9, 0x000D00F9, 0x000D00F9, 0x000E00F9, 0x000E00F9, 0x000E00F9, 
+	0x000F00F9, 0x000F00F9, 0x001000F9, 0x001000F9, 0x001000F9, 0x001100F9, 0x001100F9, 0x001200F9, 
+	0x001200F9, 0x001200F9, 0x001300F9, 0x001300F9, 0x001300F9, 0x001400F9, 0x001400F9, 0x001500F9, 
+	0x001500F9, 0x001500F9, 0x001600F9, 0x001600F8, 0x001600F8, 0x001700F8, 0x001700F8, 0x001800F8, 
+	0x001800F8, 0x001800F8, 0x001900F8, 0x001900F8, 0x001A00F8, 0x001A00F8, 0x001A00F8, 0x001B00F8, 
+	0x001B00F8, 0x001B00F8, 0x001C00F8, 0x001C00F8, 0x001D00F8, 0x001D00F8, 0x001D00F8, 0x001E00F8, 
+	0x001E00F8, 0x001E00F8, 0x001F00F8, 0x001F00F7, 0x002000F7, 0x002000F7, 0x002000F7, 0x002100F7, 
+	0x002100F7, 0x002200F7, 0x002200F7, 0x002200F7, 0x002300F7, 0x002300F7, 0x002300F7, 0x002400F7, 
+	0x002400F7, 0x002500F7, 0x002500F7, 0x002500F7, 0x002600F7, 0x002600F7, 0x002600F6, 0x002700F6, 
+	0x002700F6, 0x002800F6, 0x002800F6, 0x002800F6, 0x002900F6, 0x002900F6, 0x002900F6, 0x002A00F6, 
+	0x002A00F6, 0x002B00F6, 0x002B00F6, 0x002B00F6, 0x002C00F6, 0x002C00F5, 0x002D00F5, 0x002D00F5, 
+	0x002D00F5, 0x002E00F5, 0x002E00F5, 0x002E00F5, 0x002F00F5, 0x002F00F5, 0x003000F5, 0x003000F5, 
+	0x003000F5, 0x003100F5, 0x003100F5, 0x003100F4, 0x003200F4, 0x003200F4, 0x003300F4, 0x003300F4, 
+	0x003300F4, 0x003400F4, 0x003400F4, 0x003400F4, 0x003500F4, 0x003500F4, 0x003600F4, 0x003600F4, 
+	0x003600F3, 0x003700F3, 0x003700F3, 0x003700F3, 0x003800F3, 0x003800F3, 0x003900F3, 0x003900F3, 
+	0x003900F3, 0x003A00F3, 0x003A00F3, 0x003A00F2, 0x003B00F2, 0x003B00F2, 0x003C00F2, 0x003C00F2, 
+	0x003C00F2, 0x003D00F2, 0x003D00F2, 0x003D00F2, 0x003E00F2, 0x003E00F2, 0x003E00F1, 0x003F00F1, 
+	0x003F00F1, 0x004000F1, 0x004000F1, 0x004000F1, 0x004100F1, 0x004100F1, 0x004100F1, 0x004200F1, 
+	0x004200F0, 0x004300F0, 0x004300F0, 0x004300F0, 0x004400F0, 0x004400F0, 0x004400F0, 0x004500F0, 
+	0x004500F0, 0x004500F0, 0x004600EF, 0x004600EF, 0x004700EF, 0x004700EF, 0x004700EF, 0x004800EF, 
+	0x004800EF, 0x004800EF, 0x004900EF, 0x004900EE, 0x004A00EE, 0x004A00EE, 0x004A00EE, 0x004B00EE, 
+	0x004B00EE, 0x004B00EE, 0x004C00EE, 0x004C00ED, 0x004C00ED, 0x004D00ED, 0x004D00ED, 0x004E00ED, 
+	0x004E00ED, 0x004E00ED, 0x004F00ED, 0x004F00ED, 0x004F00EC, 0x005000EC, 0x005000EC, 0x005000EC, 
+	0x005100EC, 0x005100EC, 0x005200EC, 0x005200EC, 0x005200EB, 0x005300EB, 0x005300EB, 0x005300EB, 
+	0x005400EB, 0x005400EB, 0x005400EB, 0x005500EA, 0x005500EA, 0x005600EA, 0x005600EA, 0x005600EA, 
+	0x005700EA, 0x005700EA, 0x005700EA, 0x005800E9, 0x005800E9, 0x005800E9, 0x005900E9, 0x005900E9, 
+	0x005900E9, 0x005A00E9, 0x005A00E8, 0x005B00E8, 0x005B00E8, 0x005B00E8, 0x005C00E8, 0x005C00E8, 
+	0x005C00E8, 0x005D00E7, 0x005D00E7, 0x005D00E7, 0x005E00E7, 0x005E00E7, 0x005E00E7, 0x005F00E7, 
+	0x005F00E6, 0x006000E6, 0x006000E6, 0x006000E6, 0x006100E6, 0x006100E6, 0x006100E6, 0x006200E5, 
+	0x006200E5, 0x006200E5, 0x006300E5, 0x006300E5, 0x006300E5, 0x006400E5, 0x006400E4, 0x006400E4, 
+	0x006500E4, 0x006500E4, 0x006600E4, 0x006600E4, 0x006600E3, 0x006700E3, 0x006700E3, 0x006700E3, 
+	0x006800E3, 0x006800E3, 0x006800E2, 0x006900E2, 0x006900E2, 0x006900E2, 0x006A00E2, 0x006A00E2, 
+	0x006A00E1, 0x006B00E1, 0x006B00E1, 0x006B00E1, 0x006C00E1, 0x006C00E1, 0x006C00E1, 0x006D00E0, 
+	0x006D00E0, 0x006D00E0, 0x006E00E0, 0x006E00E0, 0x006F00DF, 0x006F00DF, 0x006F00DF, 0x007000DF, 
+	0x007000DF, 0x007000DF, 0x007100DE, 0x007100DE, 0x007100DE, 0x007200DE, 0x007200DE, 0x007200DE, 
+	0x007300DD, 0x007300DD, 0x007300DD, 0x007400DD, 0x007400DD, 0x007400DD, 0x007500DC, 0x007500DC, 
+	0x007500DC, 0x007600DC, 0x007600DC, 0x007600DB, 0x007700DB, 0x007700DB, 0x007700DB, 0x007800DB, 
+	0x007800DB, 0x007800DA, 0x007900DA, 0x007900DA, 0x007900DA, 0x007A00DA, 0x007A00D9, 0x007A00D9, 
+	0x007B00D9, 0x007B00D9, 0x007B00D9, 0x007C00D8, 0x007C00D8, 0x007C00D8, 0x007D00D8, 0x007D00D8, 
+	0x007D00D7, 0x007E00D7, 0x007E00D7, 0x007E00D7, 0x007F00D7, 0x007F00D7, 0x007F00D6, 0x008000D6, 
+	0x008000D6, 0x008000D6, 0x008100D6, 0x008100D5, 0x008100D5, 0x008200D5, 0x008200D5, 0x008200D5, 
+	0x008300D4, 0x008300D4, 0x008300D4, 0x008400D4, 0x008400D4, 0x008400D3, 0x008500D3, 0x008500D3, 
+	0x008500D3, 0x008600D3, 0x008600D2, 0x008600D2, 0x008700D2, 0x008700D2, 0x008700D1, 0x008800D1, 
+	0x008800D1, 0x008800D1, 0x008800D1, 0x008900D0, 0x008900D0, 0x008900D0, 0x008A00D0, 0x008A00D0, 
+	0x008A00CF, 0x008B00CF, 0x008B00CF, 0x008B00CF, 0x008C00CF, 0x008C00CE, 0x008C00CE, 0x008D00CE, 
+	0x008D00CE, 0x008D00CD, 0x008E00CD, 0x008E00CD, 0x008E00CD, 0x008F00CD, 0x008F00CC, 0x008F00CC, 
+	0x008F00CC, 0x009000CC, 0x009000CB, 0x009000CB, 0x009100CB, 0x009100CB, 0x009100CB, 0x009200CA, 
+	0x009200CA, 0x009200CA, 0x009300CA, 0x009300C9, 0x009300C9, 0x009300C9, 0x009400C9, 0x009400C9, 
+	0x009400C8, 0x009500C8, 0x009500C8, 0x009500C8, 0x009600C7, 0x009600C7, 0x009600C7, 0x009700C7, 
+	0x009700C6, 0x009700C6, 0x009700C6, 0x009800C6, 0x009800C6, 0x009800C5, 0x009900C5, 0x009900C5, 
+	0x009900C5, 0x009A00C4, 0x009A00C4, 0x009A00C4, 0x009B00C4, 0x009B00C3, 0x009B00C3, 0x009B00C3, 
+	0x009C00C3, 0x009C00C2, 0x009C00C2, 0x009D00C2, 0x009D00C2, 0x009D00C1, 0x009E00C1, 0x009E00C1, 
+	0x009E00C1, 0x009E00C1, 0x009F00C0, 0x009F00C0, 0x009F00C0, 0x00A000C0, 0x00A000BF, 0x00A000BF, 
+	0x00A000BF, 0x00A100BF, 0x00A100BE, 0x00A100BE, 0x00A200BE, 0x00A200BE, 0x00A200BD, 0x00A300BD, 
+	0x00A300BD, 0x00A300BD, 0x00A300BC, 0x00A400BC, 0x00A400BC, 0x00A400BC, 0x00A500BB, 0x00A500BB, 
+	0x00A500BB, 0x00A500BB, 0x00A600BA, 0x00A600BA, 0x00A600BA, 0x00A700BA, 0x00A700B9, 0x00A700B9, 
+	0x00A700B9, 0x00A800B8, 0x00A800B8, 0x00A800B8, 0x00A900B8, 0x00A900B7, 0x00A900B7, 0x00A900B7, 
+	0x00AA00B7, 0x00AA00B6, 0x00AA00B6, 0x00AA00B6, 0x00AB00B6, 0x00AB00B5, 0x00AB00B5, 0x00AC00B5, 
+	0x00AC00B5, 0x00AC00B4, 0x00AC00B4, 0x00AD00B4, 0x00AD00B4, 0x00AD00B3, 0x00AE00B3, 0x00AE00B3, 
+	0x00AE00B2, 0x00AE00B2, 0x00AF00B2, 0x00AF00B2, 0x00AF00B1, 0x00AF00B1, 0x00B000B1, 0x00B000B1, 
+	0x00B000B0, 0x00B100B0, 0x00B100B0, 0x00B100AF, 0x00B100AF, 0x00B200AF, 0x00B200AF, 0x00B200AE, 
+	0x00B200AE, 0x00B300AE, 0x00B300AE, 0x00B300AD, 0x00B400AD, 0x00B400AD, 0x00B400AC, 0x00B400AC, 
+	0x00B500AC, 0x00B500AC, 0x00B500AB, 0x00B500AB, 0x00B600AB, 0x00B600AA, 0x00B600AA, 0x00B600AA, 
+	0x00B700AA, 0x00B700A9, 0x00B700A9, 0x00B700A9, 0x00B800A9, 0x00B800A8, 0x00B800A8, 0x00B800A8, 
+	0x00B900A7, 0x00B900A7, 0x00B900A7, 0x00BA00A7, 0x00BA00A6, 0x00BA00A6, 0x00BA00A6, 0x00BB00A5, 
+	0x00BB00A5, 0x00BB00A5, 0x00BB00A5, 0x00BC00A4, 0x00BC00A4, 0x00BC00A4, 0x00BC00A3, 0x00BD00A3, 
+	0x00BD00A3, 0x00BD00A3, 0x00BD00A2, 0x00BE00A2, 0x00BE00A2, 0x00BE00A1, 0x00BE00A1, 0x00BF00A1, 
+	0x00BF00A0, 0x00BF00A0, 0x00BF00A0, 0x00C000A0, 0x00C0009F, 0x00C0009F, 0x00C0009F, 0x00C1009E, 
+	0x00C1009E, 0x00C1009E, 0x00C1009E, 0x00C1009D, 0x00C2009D, 0x00C2009D, 0x00C2009C, 0x00C2009C, 
+	0x00C3009C, 0x00C3009B, 0x00C3009B, 0x00C3009B, 0x00C4009B, 0x00C4009A, 0x00C4009A, 0x00C4009A, 
+	0x00C50099, 0x00C50099, 0x00C50099, 0x00C50098, 0x00C60098, 0x00C60098, 0x00C60097, 0x00C60097, 
+	0x00C60097, 0x00C70097, 0x00C70096, 0x00C70096, 0x00C70096, 0x00C80095, 0x00C80095, 0x00C80095, 
+	0x00C80094, 0x00C90094, 0x00C90094, 0x00C90093, 0x00C90093, 0x00C90093, 0x00CA0093, 0x00CA0092, 
+	0x00CA0092, 0x00CA0092, 0x00CB0091, 0x00CB0091, 0x00CB0091, 0x00CB0090, 0x00CB0090, 0x00CC0090, 
+	0x00CC008F, 0x00CC008F, 0x00CC008F, 0x00CD008F, 0x00CD008E, 0x00CD008E, 0x00CD008E, 0x00CD008D, 
+	0x00CE008D, 0x00CE008D, 0x00CE008C, 0x00CE008C, 0x00CF008C, 0x00CF008B, 0x00CF008B, 0x00CF008B, 
+	0x00CF008A, 0x00D0008A, 0x00D0008A, 0x00D00089, 0x00D00089, 0x00D00089, 0x00D10088, 0x00D10088, 
+	0x00D10088, 0x00D10088, 0x00D10087, 0x00D20087, 0x00D20087, 0x00D20086, 0x00D20086, 0x00D30086, 
+	0x00D30085, 0x00D30085, 0x00D30085, 0x00D30084, 0x00D40084, 0x00D40084, 0x00D40083, 0x00D40083, 
+	0x00D40083, 0x00D50082, 0x00D50082, 0x00D50082, 0x00D50081, 0x00D50081, 0x00D60081, 0x00D60080, 
+	0x00D60080, 0x00D60080, 0x00D6007F, 0x00D7007F, 0x00D7007F, 0x00D7007E, 0x00D7007E, 0x00D7007E, 
+	0x00D7007D, 0x00D8007D, 0x00D8007D, 0x00D8007C, 0x00D8007C, 0x00D8007C, 0x00D9007B, 0x00D9007B, 
+	0x00D9007B, 0x00D9007A, 0x00D9007A, 0x00DA007A, 0x00DA0079, 0x00DA0079, 0x00DA0079, 0x00DA0078, 
+	0x00DB0078, 0x00DB0078, 0x00DB0077, 0x00DB0077, 0x00DB0077, 0x00DB0076, 0x00DC0076, 0x00DC0076, 
+	0x00DC0075, 0x00DC0075, 0x00DC0075, 0x00DD0074, 0x00DD0074, 0x00DD0074, 0x00DD0073, 0x00DD0073, 
+	0x00DD0073, 0x00DE0072, 0x00DE0072, 0x00DE0072, 0x00DE0071, 0x00DE0071, 0x00DE0071, 0x00DF0070, 
+	0x00DF0070, 0x00DF0070, 0x00DF006F, 0x00DF006F, 0x00DF006F, 0x00E0006E, 0x00E0006E, 0x00E0006D, 
+	0x00E0006D, 0x00E0006D, 0x00E1006C, 0x00E1006C, 0x00E1006C, 0x00E1006B, 0x00E1006B, 0x00E1006B, 
+	0x00E1006A, 0x00E2006A, 0x00E2006A, 0x00E20069, 0x00E20069, 0x00E20069, 0x00E20068, 0x00E30068, 
+	0x00E30068, 0x00E30067, 0x00E30067, 0x00E30067, 0x00E30066, 0x00E40066, 0x00E40066, 0x00E40065, 
+	0x00E40065, 0x00E40064, 0x00E40064, 0x00E50064, 0x00E50063, 0x00E50063, 0x00E50063, 0x00E50062, 
+	0x00E50062, 0x00E50062, 0x00E60061, 0x00E60061, 0x00E60061, 0x00E60060, 0x00E60060, 0x00E60060, 
+	0x00E6005F, 0x00E7005F, 0x00E7005E, 0x00E7005E, 0x00E7005E, 0x00E7005D, 0x00E7005D, 0x00E7005D, 
+	0x00E8005C, 0x00E8005C, 0x00E8005C, 0x00E8005B, 0x00E8005B, 0x00E8005B, 0x00E8005A, 0x00E9005A, 
+	0x00E90059, 0x00E90059, 0x00E90059, 0x00E90058, 0x00E90058, 0x00E90058, 0x00EA0057, 0x00EA0057, 
+	0x00EA0057, 0x00EA0056, 0x00EA0056, 0x00EA0056, 0x00EA0055, 0x00EA0055, 0x00EB0054, 0x00EB0054, 
+	0x00EB0054, 0x00EB0053, 0x00EB0053, 0x00EB0053, 0x00EB0052, 0x00EC0052, 0x00EC0052, 0x00EC0051, 
+	0x00EC0051, 0x00EC0050, 0x00EC0050, 0x00EC0050, 0x00EC004F, 0x00ED004F, 0x00ED004F, 0x00ED004E, 
+	0x00ED004E, 0x00ED004E, 0x00ED004D, 0x00ED004D, 0x00ED004C, 0x00ED004C, 0x00EE004C, 0x00EE004B, 
+	0x00EE004B, 0x00EE004B, 0x00EE004A, 0x00EE004A, 0x00EE004A, 0x00EE0049, 0x00EF0049, 0x00EF0048, 
+	0x00EF0048, 0x00EF0048, 0x00EF0047, 0x00EF0047, 0x00EF0047, 0x00EF0046, 0x00EF0046, 0x00F00045, 
+	0x00F00045, 0x00F00045, 0x00F00044, 0x00F00044, 0x00F00044, 0x00F00043, 0x00F00043, 0x00F00043, 
+	0x00F00042, 0x00F10042, 0x00F10041, 0x00F10041, 0x00F10041, 0x00F10040, 0x00F10040, 0x00F10040, 
+	0x00F1003F, 0x00F1003F, 0x00F1003E, 0x00F2003E, 0x00F2003E, 0x00F2003D, 0x00F2003D, 0x00F2003D, 
+	0x00F2003C, 0x00F2003C, 0x00F2003C, 0x00F2003B, 0x00F2003B, 0x00F2003A, 0x00F3003A, 0x00F3003A, 
+	0x00F30039, 0x00F30039, 0x00F30039, 0x00F30038, 0x00F30038, 0x00F30037, 0x00F30037, 0x00F30037, 
+	0x00F30036, 0x00F40036, 0x00F40036, 0x00F40035, 0x00F40035, 0x00F40034, 0x00F40034, 0x00F40034, 
+	0x00F40033, 0x00F40033, 0x00F40033, 0x00F40032, 0x00F40032, 0x00F40031, 0x00F50031, 0x00F50031, 
+	0x00F50030, 0x00F50030, 0x00F50030, 0x00F5002F, 0x00F5002F, 0x00F5002E, 0x00F5002E, 0x00F5002E, 
+	0x00F5002D, 0x00F5002D, 0x00F5002D, 0x00F5002C, 0x00F6002C, 0x00F6002B, 0x00F6002B, 0x00F6002B, 
+	0x00F6002A, 0x00F6002A, 0x00F60029, 0x00F60029, 0x00F60029, 0x00F60028, 0x00F60028, 0x00F60028, 
+	0x00F60027, 0x00F60027, 0x00F60026, 0x00F70026, 0x00F70026, 0x00F70025, 0x00F70025, 0x00F70025, 
+	0x00F70024, 0x00F70024, 0x00F70023, 0x00F70023, 0x00F70023, 0x00F70022, 0x00F70022, 0x00F70022, 
+	0x00F70021, 0x00F70021, 0x00F70020, 0x00F70020, 0x00F70020, 0x00F7001F, 0x00F8001F, 0x00F8001E, 
+	0x00F8001E, 0x00F8001E, 0x00F8001D, 0x00F8001D, 0x00F8001D, 0x00F8001C, 0x00F8001C, 0x00F8001B, 
+	0x00F8001B, 0x00F8001B, 0x00F8001A, 0x00F8001A, 0x00F8001A, 0x00F80019, 0x00F80019, 0x00F80018, 
+	0x00F80018, 0x00F80018, 0x00F80017, 0x00F80017, 0x00F80016, 0x00F80016, 0x00F90016, 0x00F90015, 
+	0x00F90015, 0x00F90015, 0x00F90014, 0x00F90014, 0x00F90013, 0x00F90013, 0x00F90013, 0x00F90012, 
+	0x00F90012, 0x00F90012, 0x00F90011, 0x00F90011, 0x00F90010, 0x00F90010, 0x00F90010, 0x00F9000F, 
+	0x00F9000F, 0x00F9000E, 0x00F9000E, 0x00F9000E, 0x00F9000D, 0x00F9000D, 0x00F9000D, 0x00F9000C, 
+	0x00F9000C, 0x00F9000B, 0x00F9000B, 0x00F9000B, 0x00F9000A, 0x00F9000A, 0x00F90009, 0x00F90009, 
+	0x00F90009, 0x00F90008, 0x00F90008, 0x00F90008, 0x00F90007, 0x00F90007, 0x00F90006, 0x00F90006, 
+	0x00F90006, 0x00F90005, 0x00F90005, 0x00F90004, 0x00F90004, 0x00F90004, 0x00F90003, 0x00F90003, 
+	0x00F90003, 0x00F90002, 0x00F90002, 0x00F90001, 0x00F90001, 0x00F90001, 0x00F90000, 0x00F90000, 
+	0x00FA0000, 0x00F90000, 0x00F90000, 0x00F9FFFF, 0x00F9FFFF, 0x00F9FFFF, 0x00F9FFFE, 0x00F9FFFE, 
+	0x00F9FFFD, 0x00F9FFFD, 0x00F9FFFD, 0x00F9FFFC, 0x00F9FFFC, 0x00F9FFFC, 0x00F9FFFB, 0x00F9FFFB, 
+	0x00F9FFFA, 0x00F9FFFA, 0x00F9FFFA, 0x00F9FFF9, 0x00F9FFF9, 0x00F9FFF8, 0x00F9FFF8, 0x00F9FFF8, 
+	0x00F9FFF7, 0x00F9FFF7, 0x00F9FFF7, 0x00F9FFF6, 0x00F9FFF6, 0x00F9FFF5, 0x00F9FFF5, 0x00F9FFF5, 
+	0x00F9FFF4, 0x00F9FFF4, 0x00F9FFF3, 0x00F9FFF3, 0x00F9FFF3, 0x00F9FFF2, 0x00F9FFF2, 0x00F9FFF2, 
+	0x00F9FFF1, 0x00F9FFF1, 0x00F9FFF0, 0x00F9FFF0, 0x00F9FFF0, 0x00F9FFEF, 0x00F9FFEF, 0x00F9FFEE, 
+	0x00F9FFEE, 0x00F9FFEE, 0x00F9FFED, 0x00F9FFED, 0x00F9FFED, 0x00F9FFEC, 0x00F9FFEC, 0x00F9FFEB, 
+	0x00F9FFEB, 0x00F9FFEB, 0x00F9FFEA, 0x00F8FFEA, 0x00F8FFEA, 0x00F8FFE9, 0x00F8FFE9, 0x00F8FFE8, 
+	0x00F8FFE8, 0x00F8FFE8, 0x00F8FFE7, 0x00F8FFE7, 0x00F8FFE6, 0x00F8FFE6, 0x00F8FFE6, 0x00F8FFE5, 
+	0x00F8FFE5, 0x00F8FFE5, 0x00F8FFE4, 0x00F8FFE4, 0x00F8FFE3, 0x00F8FFE3, 0x00F8FFE3, 0x00F8FFE2, 
+	0x00F8FFE2, 0x00F8FFE2, 0x00F8FFE1, 0x00F7FFE1, 0x00F7FFE0, 0x00F7FFE0, 0x00F7FFE0, 0x00F7FFDF, 
+	0x00F7FFDF, 0x00F7FFDE, 0x00F7FFDE, 0x00F7FFDE, 0x00F7FFDD, 0x00F7FFDD, 0x00F7FFDD, 0x00F7FFDC, 
+	0x00F7FFDC, 0x00F7FFDB, 0x00F7FFDB, 0x00F7FFDB, 0x00F7FFDA, 0x00F7FFDA, 0x00F6FFDA, 0x00F6FFD9, 
+	0x00F6FFD9, 0x00F6FFD8, 0x00F6FFD8, 0x00F6FFD8, 0x00F6FFD7, 0x00F6FFD7, 0x00F6FFD7, 0x00F6FFD6, 
+	0x00F6FFD6, 0x00F6FFD5, 0x00F6FFD5, 0x00F6FFD5, 0x00F6FFD4, 0x00F5FFD4, 0x00F5FFD3, 0x00F5FFD3, 
+	0x00F5FFD3, 0x00F5FFD2, 0x00F5FFD2, 0x00F5FFD2, 0x00F5FFD1, 0x00F5FFD1, 0x00F5FFD0, 0x00F5FFD0, 
+	0x00F5FFD0, 0x00F5FFCF, 0x00F5FFCF, 0x00F4FFCF, 0x00F4FFCE, 0x00F4FFCE, 0x00F4FFCD, 0x00F4FFCD, 
+	0x00F4FFCD, 0x00F4FFCC, 0x00F4FFCC, 0x00F4FFCC, 0x00F4FFCB, 0x00F4FFCB, 0x00F4FFCA, 0x00F4FFCA, 
+	0x00F3FFCA, 0x00F3FFC9, 0x00F3FFC9, 0x00F3FFC9, 0x00F3FFC8, 0x00F3FFC8, 0x00F3FFC7, 0x00F3FFC7, 
+	0x00F3FFC7, 0x00F3FFC6, 0x00F3FFC6, 0x00F2FFC6, 0x00F2FFC5, 0x00F2FFC5, 0x00F2FFC4, 0x00F2FFC4, 
+	0x00F2FFC4, 0x00F2FFC3, 0x00F2FFC3, 0x00F2FFC3, 0x00F2FFC2, 0x00F2FFC2, 0x00F1FFC2, 0x00F1FFC1, 
+	0x00F1FFC1, 0x00F1FFC0, 0x00F1FFC0, 0x00F1FFC0, 0x00F1FFBF, 0x00F1FFBF, 0x00F1FFBF, 0x00F1FFBE, 
+	0x00F0FFBE, 0x00F0FFBD, 0x00F0FFBD, 0x00F0FFBD, 0x00F0FFBC, 0x00F0FFBC, 0x00F0FFBC, 0x00F0FFBB, 
+	0x00F0FFBB, 0x00F0FFBB, 0x00EFFFBA, 0x00EFFFBA, 0x00EFFFB9, 0x00EFFFB9, 0x00EFFFB9, 0x00EFFFB8, 
+	0x00EFFFB8, 0x00EFFFB8, 0x00EFFFB7, 0x00EEFFB7, 0x00EEFFB6, 0x00EEFFB6, 0x00EEFFB6, 0x00EEFFB5, 
+	0x00EEFFB5, 0x00EEFFB5, 0x00EEFFB4, 0x00EDFFB4, 0x00EDFFB4, 0x00EDFFB3, 0x00EDFFB3, 0x00EDFFB2, 
+	0x00EDFFB2, 0x00EDFFB2, 0x00EDFFB1, 0x00EDFFB1, 0x00ECFFB1, 0x00ECFFB0, 0x00ECFFB0, 0x00ECFFB0, 
+	0x00ECFFAF, 0x00ECFFAF, 0x00ECFFAE, 0x00ECFFAE, 0x00EBFFAE, 0x00EBFFAD, 0x00EBFFAD, 0x00EBFFAD, 
+	0x00EBFFAC, 0x00EBFFAC, 0x00EBFFAC, 0x00EAFFAB, 0x00EAFFAB, 0x00EAFFAA, 0x00EAFFAA, 0x00EAFFAA, 
+	0x00EAFFA9, 0x00EAFFA9, 0x00EAFFA9, 0x00E9FFA8, 0x00E9FFA8, 0x00E9FFA8, 0x00E9FFA7, 0x00E9FFA7, 
+	0x00E9FFA7, 0x00E9FFA6, 0x00E8FFA6, 0x00E8FFA5, 0x00E8FFA5, 0x00E8FFA5, 0x00E8FFA4, 0x00E8FFA4, 
+	0x00E8FFA4, 0x00E7FFA3, 0x00E7FFA3, 0x00E7FFA3, 0x00E7FFA2, 0x00E7FFA2, 0x00E7FFA2, 0x00E7FFA1, 
+	0x00E6FFA1, 0x00E6FFA0, 0x00E6FFA0, 0x00E6FFA0, 0x00E6FF9F, 0x00E6FF9F, 0x00E6FF9F, 0x00E5FF9E, 
+	0x00E5FF9E, 0x00E5FF9E, 0x00E5FF9D, 0x00E5FF9D, 0x00E5FF9D, 0x00E5FF9C, 0x00E4FF9C, 0x00E4FF9C, 
+	0x00E4FF9B, 0x00E4FF9B, 0x00E4FF9A, 0x00E4FF9A, 0x00E3FF9A, 0x00E3FF99, 0x00E3FF99, 0x00E3FF99, 
+	0x00E3FF98, 0x00E3FF98, 0x00E2FF98, 0x00E2FF97, 0x00E2FF97, 0x00E2FF97, 0x00E2FF96, 0x00E2FF96, 
+	0x00E1FF96, 0x00E1FF95, 0x00E1FF95, 0x00E1FF95, 0x00E1FF94, 0x00E1FF94, 0x00E1FF94, 0x00E0FF93, 
+	0x00E0FF93, 0x00E0FF93, 0x00E0FF92, 0x00E0FF92, 0x00DFFF91, 0x00DFFF91, 0x00DFFF91, 0x00DFFF90, 
+	0x00DFFF90, 0x00DFFF90, 0x00DEFF8F, 0x00DEFF8F, 0x00DEFF8F, 0x00DEFF8E, 0x00DEFF8E, 0x00DEFF8E, 
+	0x00DDFF8D, 0x00DDFF8D, 0x00DDFF8D, 0x00DDFF8C, 0x00DDFF8C, 0x00DDFF8C, 0x00DCFF8B, 0x00DCFF8B, 
+	0x00DCFF8B, 0x00DCFF8A, 0x00DCFF8A, 0x00DBFF8A, 0x00DBFF89, 0x00DBFF89, 0x00DBFF89, 0x00DBFF88, 
+	0x00DBFF88, 0x00DAFF88, 0x00DAFF87, 0x00DAFF87, 0x00DAFF87, 0x00DAFF86, 0x00D9FF86, 0x00D9FF86, 
+	0x00D9FF85, 0x00D9FF85, 0x00D9FF85, 0x00D8FF84, 0x00D8FF84, 0x00D8FF84, 0x00D8FF83, 0x00D8FF83, 
+	0x00D7FF83, 0x00D7FF82, 0x00D7FF82, 0x00D7FF82, 0x00D7FF81, 0x00D7FF81, 0x00D6FF81, 0x00D6FF80, 
+	0x00D6FF80, 0x00D6FF80, 0x00D6FF7F, 0x00D5FF7F, 0x00D5FF7F, 0x00D5FF7E, 0x00D5FF7E, 0x00D5FF7E, 
+	0x00D4FF7D, 0x00D4FF7D, 0x00D4FF7D, 0x00D4FF7C, 0x00D4FF7C, 0x00D3FF7C, 0x00D3FF7B, 0x00D3FF7B, 
+	0x00D3FF7B, 0x00D3FF7A, 0x00D2FF7A, 0x00D2FF7A, 0x00D2FF79, 0x00D2FF79, 0x00D1FF79, 0x00D1FF78, 
+	0x00D1FF78, 0x00D1FF78, 0x00D1FF78, 0x00D0FF77, 0x00D0FF77, 0x00D0FF77, 0x00D0FF76, 0x00D0FF76, 
+	0x00CFFF76, 0x00CFFF75, 0x00CFFF75, 0x00CFFF75, 0x00CFFF74, 0x00CEFF74, 0x00CEFF74, 0x00CEFF73, 
+	0x00CEFF73, 0x00CDFF73, 0x00CDFF72, 0x00CDFF72, 0x00CDFF72, 0x00CDFF71, 0x00CCFF71, 0x00CCFF71, 
+	0x00CCFF71, 0x00CCFF70, 0x00CBFF70, 0x00CBFF70, 0x00CBFF6F, 0x00CBFF6F, 0x00CBFF6F, 0x00CAFF6E, 
+	0x00CAFF6E, 0x00CAFF6E, 0x00CAFF6D, 0x00C9FF6D, 0x00C9FF6D, 0x00C9FF6D, 0x00C9FF6C, 0x00C9FF6C, 
+	0x00C8FF6C, 0x00C8FF6B, 0x00C8FF6B, 0x00C8FF6B, 0x00C7FF6A, 0x00C7FF6A, 0x00C7FF6A, 0x00C7FF69, 
+	0x00C6FF69, 0x00C6FF69, 0x00C6FF69, 0x00C6FF68, 0x00C6FF68, 0x00C5FF68, 0x00C5FF67, 0x00C5FF67, 
+	0x00C5FF67, 0x00C4FF66, 0x00C4FF66, 0x00C4FF66, 0x00C4FF65, 0x00C3FF65, 0x00C3FF65, 0x00C3FF65, 
+	0x00C3FF64, 0x00C2FF64, 0x00C2FF64, 0x00C2FF63, 0x00C2FF63, 0x00C1FF63, 0x00C1FF62, 0x00C1FF62, 
+	0x00C1FF62, 0x00C1FF62, 0x00C0FF61, 0x00C0FF61, 0x00C0FF61, 0x00C0FF60, 0x00BFFF60, 0x00BFFF60, 
+	0x00BFFF60, 0x00BFFF5F, 0x00BEFF5F, 0x00BEFF5F, 0x00BEFF5E, 0x00BEFF5E, 0x00BDFF5E, 0x00BDFF5D, 
+	0x00BDFF5D, 0x00BDFF5D, 0x00BCFF5D, 0x00BCFF5C, 0x00BCFF5C, 0x00BCFF5C, 0x00BBFF5B, 0x00BBFF5B, 
+	0x00BBFF5B, 0x00BBFF5B, 0x00BAFF5A, 0x00BAFF5A, 0x00BAFF5A, 0x00BAFF59, 0x00B9FF59, 0x00B9FF59, 
+	0x00B9FF59, 0x00B8FF58, 0x00B8FF58, 0x00B8FF58, 0x00B8FF57, 0x00B7FF57, 0x00B7FF57, 0x00B7FF57, 
+	0x00B7FF56, 0x00B6FF56, 0x00B6FF56, 0x00B6FF56, 0x00B6FF55, 0x00B5FF55, 0x00B5FF55, 0x00B5FF54, 
+	0x00B5FF54, 0x00B4FF54, 0x00B4FF54, 0x00B4FF53, 0x00B4FF53, 0x00B3FF53, 0x00B3FF52, 0x00B3FF52, 
+	0x00B2FF52, 0x00B2FF52, 0x00B2FF51, 0x00B2FF51, 0x00B1FF51, 0x00B1FF51, 0x00B1FF50, 0x00B1FF50, 
+	0x00B0FF50, 0x00B0FF4F, 0x00B0FF4F, 0x00AFFF4F, 0x00AFFF4F, 0x00AFFF4E, 0x00AFFF4E, 0x00AEFF4E, 
+	0x00AEFF4E, 0x00AEFF4D, 0x00AEFF4D, 0x00ADFF4D, 0x00ADFF4C, 0x00ADFF4C, 0x00ACFF4C, 0x00ACFF4C, 
+	0x00ACFF4B, 0x00ACFF4B, 0x00ABFF4B, 0x00ABFF4B, 0x00ABFF4A, 0x00AAFF4A, 0x00AAFF4A, 0x00AAFF4A, 
+	0x00AAFF49, 0x00A9FF49, 0x00A9FF49, 0x00A9FF49, 0x00A9FF48, 0x00A8FF48, 0x00A8FF48, 0x00A8FF48, 
+	0x00A7FF47, 0x00A7FF47, 0x00A7FF47, 0x00A7FF46, 0x00A6FF46, 0x00A6FF46, 0x00A6FF46, 0x00A5FF45, 
+	0x00A5FF45, 0x00A5FF45, 0x00A5FF45, 0x00A4FF44, 0x00A4FF44, 0x00A4FF44, 0x00A3FF44, 0x00A3FF43, 
+	0x00A3FF43, 0x00A3FF43, 0x00A2FF43, 0x00A2FF42, 0x00A2FF42, 0x00A1FF42, 0x00A1FF42, 0x00A1FF41, 
+	0x00A0FF41, 0x00A0FF41, 0x00A0FF41, 0x00A0FF40, 0x009FFF40, 0x009FFF40, 0x009FFF40, 0x009EFF3F, 
+	0x009EFF3F, 0x009EFF3F, 0x009EFF3F, 0x009DFF3F, 0x009DFF3E, 0x009DFF3E, 0x009CFF3E, 0x009CFF3E, 
+	0x009CFF3D, 0x009BFF3D, 0x009BFF3D, 0x009BFF3D, 0x009BFF3C, 0x009AFF3C, 0x009AFF3C, 0x009AFF3C, 
+	0x0099FF3B, 0x0099FF3B, 0x0099FF3B, 0x0098FF3B, 0x0098FF3A, 0x0098FF3A, 0x0097FF3A, 0x0097FF3A, 
+	0x0097FF3A, 0x0097FF39, 0x0096FF39, 0x0096FF39, 0x0096FF39, 0x0095FF38, 0x0095FF38, 0x0095FF38, 
+	0x0094FF38, 0x0094FF37, 0x0094FF37, 0x0093FF37, 0x0093FF37, 0x0093FF37, 0x0093FF36, 0x0092FF36, 
+	0x0092FF36, 0x0092FF36, 0x0091FF35, 0x0091FF35, 0x0091FF35, 0x0090FF35, 0x0090FF35, 0x0090FF34, 
+	0x008FFF34, 0x008FFF34, 0x008FFF34, 0x008FFF33, 0x008EFF33, 0x008EFF33, 0x008EFF33, 0x008DFF33, 
+	0x008DFF32, 0x008DFF32, 0x008CFF32, 0x008CFF32, 0x008CFF31, 0x008BFF31, 0x008BFF31, 0x008BFF31, 
+	0x008AFF31, 0x008AFF30, 0x008AFF30, 0x0089FF30, 0x0089FF30, 0x0089FF30, 0x0088FF2F, 0x0088FF2F, 
+	0x0088FF2F, 0x0088FF2F, 0x0087FF2F, 0x0087FF2E, 0x0087FF2E, 0x0086FF2E, 0x0086FF2E, 0x0086FF2D, 
+	0x0085FF2D, 0x0085FF2D, 0x0085FF2D, 0x0084FF2D, 0x0084FF2C, 0x0084FF2C, 0x0083FF2C, 0x0083FF2C, 
+	0x0083FF2C, 0x0082FF2B, 0x0082FF2B, 0x0082FF2B, 0x0081FF2B, 0x0081FF2B, 0x0081FF2A, 0x0080FF2A, 
+	0x0080FF2A, 0x0080FF2A, 0x007FFF2A, 0x007FFF29, 0x007FFF29, 0x007EFF29, 0x007EFF29, 0x007EFF29, 
+	0x007DFF29, 0x007DFF28, 0x007DFF28, 0x007CFF28, 0x007CFF28, 0x007CFF28, 0x007BFF27, 0x007BFF27, 
+	0x007BFF27, 0x007AFF27, 0x007AFF27, 0x007AFF26, 0x0079FF26, 0x0079FF26, 0x0079FF26, 0x0078FF26, 
+	0x0078FF25, 0x0078FF25, 0x0077FF25, 0x0077FF25, 0x0077FF25, 0x0076FF25, 0x0076FF24, 0x0076FF24, 
+	0x0075FF24, 0x0075FF24, 0x0075FF24, 0x0074FF23, 0x0074FF23, 0x0074FF23, 0x0073FF23, 0x0073FF23, 
+	0x0073FF23, 0x0072FF22, 0x0072FF22, 0x0072FF22, 0x0071FF22, 0x0071FF22, 0x0071FF22, 0x0070FF21, 
+	0x0070FF21, 0x0070FF21, 0x006FFF21, 0x006FFF21, 0x006FFF21, 0x006EFF20, 0x006EFF20, 0x006DFF20, 
+	0x006DFF20, 0x006DFF20, 0x006CFF1F, 0x006CFF1F, 0x006CFF1F, 0x006BFF1F, 0x006BFF1F, 0x006BFF1F, 
+	0x006AFF1F, 0x006AFF1E, 0x006AFF1E, 0x0069FF1E, 0x0069FF1E, 0x0069FF1E, 0x0068FF1E, 0x0068FF1D, 
+	0x0068FF1D, 0x0067FF1D, 0x0067FF1D, 0x0067FF1D, 0x0066FF1D, 0x0066FF1C, 0x0066FF1C, 0x0065FF1C, 
+	0x0065FF1C, 0x0064FF1C, 0x0064FF1C, 0x0064FF1B, 0x0063FF1B, 0x0063FF1B, 0x0063FF1B, 0x0062FF1B, 
+	0x0062FF1B, 0x0062FF1B, 0x0061FF1A, 0x0061FF1A, 0x0061FF1A, 0x0060FF1A, 0x0060FF1A, 0x0060FF1A, 
+	0x005FFF1A, 0x005FFF19, 0x005EFF19, 0x005EFF19, 0x005EFF19, 0x005DFF19, 0x005DFF19, 0x005DFF19, 
+	0x005CFF18, 0x005CFF18, 0x005CFF18, 0x005BFF18, 0x005BFF18, 0x005BFF18, 0x005AFF18, 0x005AFF17, 
+	0x0059FF17, 0x0059FF17, 0x0059FF17, 0x0058FF17, 0x0058FF17, 0x0058FF17, 0x0057FF16, 0x0057FF16, 
+	0x0057FF16, 0x0056FF16, 0x0056FF16, 0x0056FF16, 0x0055FF16, 0x0055FF16, 0x0054FF15, 0x0054FF15, 
+	0x0054FF15, 0x0053FF15, 0x0053FF15, 0x0053FF15, 0x0052FF15, 0x0052FF14, 0x0052FF14, 0x0051FF14, 
+	0x0051FF14, 0x0050FF14, 0x0050FF14, 0x0050FF14, 0x004FFF14, 0x004FFF13, 0x004FFF13, 0x004EFF13, 
+	0x004EFF13, 0x004EFF13, 0x004DFF13, 0x004DFF13, 0x004CFF13, 0x004CFF13, 0x004CFF12, 0x004BFF12, 
+	0x004BFF12, 0x004BFF12, 0x004AFF12, 0x004AFF12, 0x004AFF12, 0x0049FF12, 0x0049FF11, 0x0048FF11, 
+	0x0048FF11, 0x0048FF11, 0x0047FF11, 0x0047FF11, 0x0047FF11, 0x0046FF11, 0x0046FF11, 0x0045FF10, 
+	0x0045FF10, 0x0045FF10, 0x0044FF10, 0x0044FF10, 0x0044FF10, 0x0043FF10, 0x0043FF10, 0x0043FF10, 
+	0x0042FF10, 0x0042FF0F, 0x0041FF0F, 0x0041FF0F, 0x0041FF0F, 0x0040FF0F, 0x0040FF0F, 0x0040FF0F, 
+	0x003FFF0F, 0x003FFF0F, 0x003EFF0F, 0x003EFF0E, 0x003EFF0E, 0x003DFF0E, 0x003DFF0E, 0x003DFF0E, 
+	0x003CFF0E, 0x003CFF0E, 0x003CFF0E, 0x003BFF0E, 0x003BFF0E, 0x003AFF0E, 0x003AFF0D, 0x003AFF0D, 
+	0x0039FF0D, 0x0039FF0D, 0x0039FF0D, 0x0038FF0D, 0x0038FF0D, 0x0037FF0D, 0x0037FF0D, 0x0037FF0D, 
+	0x0036FF0D, 0x0036FF0C, 0x0036FF0C, 0x0035FF0C, 0x0035FF0C, 0x0034FF0C, 0x0034FF0C, 0x0034FF0C, 
+	0x0033FF0C, 0x0033FF0C, 0x0033FF0C, 0x0032FF0C, 0x0032FF0C, 0x0031FF0C, 0x0031FF0B, 0x0031FF0B, 
+	0x0030FF0B, 0x0030FF0B, 0x0030FF0B, 0x002FFF0B, 0x002FFF0B, 0x002EFF0B, 0x002EFF0B, 0x002EFF0B, 
+	0x002DFF0B, 0x002DFF0B, 0x002DFF0B, 0x002CFF0B, 0x002CFF0A, 0x002BFF0A, 0x002BFF0A, 0x002BFF0A, 
+	0x002AFF0A, 0x002AFF0A, 0x0029FF0A, 0x0029FF0A, 0x0029FF0A, 0x0028FF0A, 0x0028FF0A, 0x0028FF0A, 
+	0x0027FF0A, 0x0027FF0A, 0x0026FF0A, 0x0026FF09, 0x0026FF09, 0x0025FF09, 0x0025FF09, 0x0025FF09, 
+	0x0024FF09, 0x0024FF09, 0x0023FF09, 0x0023FF09, 0x0023FF09, 0x0022FF09, 0x0022FF09, 0x0022FF09, 
+	0x0021FF09, 0x0021FF09, 0x0020FF09, 0x0020FF09, 0x0020FF09, 0x001FFF09, 0x001FFF08, 0x001EFF08, 
+	0x001EFF08, 0x001EFF08, 0x001DFF08, 0x001DFF08, 0x001DFF08, 0x001CFF08, 0x001CFF08, 0x001BFF08, 
+	0x001BFF08, 0x001BFF08, 0x001AFF08, 0x001AFF08, 0x001AFF08, 0x0019FF08, 0x0019FF08, 0x0018FF08, 
+	0x0018FF08, 0x0018FF08, 0x0017FF08, 0x0017FF08, 0x0016FF08, 0x0016FF08, 0x0016FF07, 0x0015FF07, 
+	0x0015FF07, 0x0015FF07, 0x0014FF07, 0x0014FF07, 0x0013FF07, 0x0013FF07, 0x0013FF07, 0x0012FF07, 
+	0x0012FF07, 0x0012FF07, 0x0011FF07, 0x0011FF07, 0x0010FF07, 0x0010FF07, 0x0010FF07, 0x000FFF07, 
+	0x000FFF07, 0x000EFF07, 0x000EFF07, 0x000EFF07, 0x000DFF07, 0x000DFF07, 0x000DFF07, 0x000CFF07, 
+	0x000CFF07, 0x000BFF07, 0x000BFF07, 0x000BFF07, 0x000AFF07, 0x000AFF07, 0x0009FF07, 0x0009FF07, 
+	0x0009FF07, 0x0008FF07, 0x0008FF07, 0x0008FF07, 0x0007FF07, 0x0007FF07, 0x0006FF07, 0x0006FF07, 
+	0x0006FF07, 0x0005FF07, 0x0005FF07, 0x0004FF07, 0x0004FF07, 0x0004FF07, 0x0003FF07, 0x0003FF07, 
+	0x0003FF07, 0x0002FF07, 0x0002FF07, 0x0001FF07, 0x0001FF07, 0x0001FF07, 0x0000FF07, 0x0000FF07, 
+	0x0000FF06, 0x0000FF07, 0x0000FF07, 0xFFFFFF07, 0xFFFFFF07, 0xFFFFFF07, 0xFFFEFF07, 0xFFFEFF07, 
+	0xFFFDFF07, 0xFFFDFF07, 0xFFFDFF07, 0xFFFCFF07, 0xFFFCFF07, 0xFFFCFF07, 0xFFFBFF07, 0xFFFBFF07, 
+	0xFFFAFF07, 0xFFFAFF07, 0xFFFAFF07, 0xFFF9FF07, 0xFFF9FF07, 0xFFF8FF07, 0xFFF8FF07, 0xFFF8FF07, 
+	0xFFF7FF07, 0xFFF7FF07, 0xFFF7FF07, 0xFFF6FF07, 0xFFF6FF07, 0xFFF5FF07, 0xFFF5FF07, 0xFFF5FF07, 
+	0xFFF4FF07, 0xFFF4FF07, 0xFFF3FF07, 0xFFF3FF07, 0xFFF3FF07, 0xFFF2FF07, 0xFFF2FF07, 0xFFF2FF07, 
+	0xFFF1FF07, 0xFFF1FF07, 0xFFF0FF07, 0xFFF0FF07, 0xFFF0FF07, 0xFFEFFF07, 0xFFEFFF07, 0xFFEEFF07, 
+	0xFFEEFF07, 0xFFEEFF07, 0xFFEDFF07, 0xFFEDFF07, 0xFFEDFF07, 0xFFECFF07, 0xFFECFF07, 0xFFEBFF07, 
+	0xFFEBFF07, 0xFFEBFF07, 0xFFEAFF07, 0xFFEAFF08, 0xFFEAFF08, 0xFFE9FF08, 0xFFE9FF08, 0xFFE8FF08, 
+	0xFFE8FF08, 0xFFE8FF08, 0xFFE7FF08, 0xFFE7FF08, 0xFFE6FF08, 0xFFE6FF08, 0xFFE6FF08, 0xFFE5FF08, 
+	0xFFE5FF08, 0xFFE5FF08, 0xFFE4FF08, 0xFFE4FF08, 0xFFE3FF08, 0xFFE3FF08, 0xFFE3FF08, 0xFFE2FF08, 
+	0xFFE2FF08, 0xFFE2FF08, 0xFFE1FF08, 0xFFE1FF09, 0xFFE0FF09, 0xFFE0FF09, 0xFFE0FF09, 0xFFDFFF09, 
+	0xFFDFFF09, 0xFFDEFF09, 0xFFDEFF09, 0xFFDEFF09, 0xFFDDFF09, 0xFFDDFF09, 0xFFDDFF09, 0xFFDCFF09, 
+	0xFFDCFF09, 0xFFDBFF09, 0xFFDBFF09, 0xFFDBFF09, 0xFFDAFF09, 0xFFDAFF09, 0xFFDAFF0A, 0xFFD9FF0A, 
+	0xFFD9FF0A, 0xFFD8FF0A, 0xFFD8FF0A, 0xFFD8FF0A, 0xFFD7FF0A, 0xFFD7FF0A, 0xFFD7FF0A, 0xFFD6FF0A, 
+	0xFFD6FF0A, 0xFFD5FF0A, 0xFFD5FF0A, 0xFFD5FF0A, 0xFFD4FF0A, 0xFFD4FF0B, 0xFFD3FF0B, 0xFFD3FF0B, 
+	0xFFD3FF0B, 0xFFD2FF0B, 0xFFD2FF0B, 0xFFD2FF0B, 0xFFD1FF0B, 0xFFD1FF0B, 0xFFD0FF0B, 0xFFD0FF0B, 
+	0xFFD0FF0B, 0xFFCFFF0B, 0xFFCFFF0B, 0xFFCFFF0C, 0xFFCEFF0C, 0xFFCEFF0C, 0xFFCDFF0C, 0xFFCDFF0C, 
+	0xFFCDFF0C, 0xFFCCFF0C, 0xFFCCFF0C, 0xFFCCFF0C, 0xFFCBFF0C, 0xFFCBFF0C, 0xFFCAFF0C, 0xFFCAFF0C, 
+	0xFFCAFF0D, 0xFFC9FF0D, 0xFFC9FF0D, 0xFFC9FF0D, 0xFFC8FF0D, 0xFFC8FF0D, 0xFFC7FF0D, 0xFFC7FF0D, 
+	0xFFC7FF0D, 0xFFC6FF0D, 0xFFC6FF0D, 0xFFC6FF0E, 0xFFC5FF0E, 0xFFC5FF0E, 0xFFC4FF0E, 0xFFC4FF0E, 
+	0xFFC4FF0E, 0xFFC3FF0E, 0xFFC3FF0E, 0xFFC3FF0E, 0xFFC2FF0E, 0xFFC2FF0E, 0xFFC2FF0F, 0xFFC1FF0F, 
+	0xFFC1FF0F, 0xFFC0FF0F, 0xFFC0FF0F, 0xFFC0FF0F, 0xFFBFFF0F, 0xFFBFFF0F, 0xFFBFFF0F, 0xFFBEFF0F, 
+	0xFFBEFF10, 0xFFBDFF10, 0xFFBDFF10, 0xFFBDFF10, 0xFFBCFF10, 0xFFBCFF10, 0xFFBCFF10, 0xFFBBFF10, 
+	0xFFBBFF10, 0xFFBBFF10, 0xFFBAFF11, 0xFFBAFF11, 0xFFB9FF11, 0xFFB9FF11, 0xFFB9FF11, 0xFFB8FF11, 
+	0xFFB8FF11, 0xFFB8FF11, 0xFFB7FF11, 0xFFB7FF12, 0xFFB6FF12, 0xFFB6FF12, 0xFFB6FF12, 0xFFB5FF12, 
+	0xFFB5FF12, 0xFFB5FF12, 0xFFB4FF12, 0xFFB4FF13, 0xFFB4FF13, 0xFFB3FF13, 0xFFB3FF13, 0xFFB2FF13, 
+	0xFFB2FF13, 0xFFB2FF13, 0xFFB1FF13, 0xFFB1FF13, 0xFFB1FF14, 0xFFB0FF14, 0xFFB0FF14, 0xFFB0FF14, 
+	0xFFAFFF14, 0xFFAFFF14, 0xFFAEFF14, 0xFFAEFF14, 0xFFAEFF15, 0xFFADFF15, 0xFFADFF15, 0xFFADFF15, 
+	0xFFACFF15, 0xFFACFF15, 0xFFACFF15, 0xFFABFF16, 0xFFABFF16, 0xFFAAFF16, 0xFFAAFF16, 0xFFAAFF16, 
+	0xFFA9FF16, 0xFFA9FF16, 0xFFA9FF16, 0xFFA8FF17, 0xFFA8FF17, 0xFFA8FF17, 0xFFA7FF17, 0xFFA7FF17, 
+	0xFFA7FF17, 0xFFA6FF17, 0xFFA6FF18, 0xFFA5FF18, 0xFFA5FF18, 0xFFA5FF18, 0xFFA4FF18, 0xFFA4FF18, 
+	0xFFA4FF18, 0xFFA3FF19, 0xFFA3FF19, 0xFFA3FF19, 0xFFA2FF19, 0xFFA2FF19, 0xFFA2FF19, 0xFFA1FF19, 
+	0xFFA1FF1A, 0xFFA0FF1A, 0xFFA0FF1A, 0xFFA0FF1A, 0xFF9FFF1A, 0xFF9FFF1A, 0xFF9FFF1A, 0xFF9EFF1B, 
+	0xFF9EFF1B, 0xFF9EFF1B, 0xFF9DFF1B, 0xFF9DFF1B, 0xFF9DFF1B, 0xFF9CFF1B, 0xFF9CFF1C, 0xFF9CFF1C, 
+	0xFF9BFF1C, 0xFF9BFF1C, 0xFF9AFF1C, 0xFF9AFF1C, 0xFF9AFF1D, 0xFF99FF1D, 0xFF99FF1D, 0xFF99FF1D, 
+	0xFF98FF1D, 0xFF98FF1D, 0xFF98FF1E, 0xFF97FF1E, 0xFF97FF1E, 0xFF97FF1E, 0xFF96FF1E, 0xFF96FF1E, 
+	0xFF96FF1F, 0xFF95FF1F, 0xFF95FF1F, 0xFF95FF1F, 0xFF94FF1F, 0xFF94FF1F, 0xFF94FF1F, 0xFF93FF20, 
+	0xFF93FF20, 0xFF93FF20, 0xFF92FF20, 0xFF92FF20, 0xFF91FF21, 0xFF91FF21, 0xFF91FF21, 0xFF90FF21, 
+	0xFF90FF21, 0xFF90FF21, 0xFF8FFF22, 0xFF8FFF22, 0xFF8FFF22, 0xFF8EFF22, 0xFF8EFF22, 0xFF8EFF22, 
+	0xFF8DFF23, 0xFF8DFF23, 0xFF8DFF23, 0xFF8CFF23, 0xFF8CFF23, 0xFF8CFF23, 0xFF8BFF24, 0xFF8BFF24, 
+	0xFF8BFF24, 0xFF8AFF24, 0xFF8AFF24, 0xFF8AFF25, 0xFF89FF25, 0xFF89FF25, 0xFF89FF25, 0xFF88FF25, 
+	0xFF88FF25, 0xFF88FF26, 0xFF87FF26, 0xFF87FF26, 0xFF87FF26, 0xFF86FF26, 0xFF86FF27, 0xFF86FF27, 
+	0xFF85FF27, 0xFF85FF27, 0xFF85FF27, 0xFF84FF28, 0xFF84FF28, 0xFF84FF28, 0xFF83FF28, 0xFF83FF28, 
+	0xFF83FF29, 0xFF82FF29, 0xFF82FF29, 0xFF82FF29, 0xFF81FF29, 0xFF81FF29, 0xFF81FF2A, 0xFF80FF2A, 
+	0xFF80FF2A, 0xFF80FF2A, 0xFF7FFF2A, 0xFF7FFF2B, 0xFF7FFF2B, 0xFF7EFF2B, 0xFF7EFF2B, 0xFF7EFF2B, 
+	0xFF7DFF2C, 0xFF7DFF2C, 0xFF7DFF2C, 0xFF7CFF2C, 0xFF7CFF2C, 0xFF7CFF2D, 0xFF7BFF2D, 0xFF7BFF2D, 
+	0xFF7BFF2D, 0xFF7AFF2D, 0xFF7AFF2E, 0xFF7AFF2E, 0xFF79FF2E, 0xFF79FF2E, 0xFF79FF2F, 0xFF78FF2F, 
+	0xFF78FF2F, 0xFF78FF2F, 0xFF78FF2F, 0xFF77FF30, 0xFF77FF30, 0xFF77FF30, 0xFF76FF30, 0xFF76FF30, 
+	0xFF76FF31, 0xFF75FF31, 0xFF75FF31, 0xFF75FF31, 0xFF74FF31, 0xFF74FF32, 0xFF74FF32, 0xFF73FF32, 
+	0xFF73FF32, 0xFF73FF33, 0xFF72FF33, 0xFF72FF33, 0xFF72FF33, 0xFF71FF33, 0xFF71FF34, 0xFF71FF34, 
+	0xFF71FF34, 0xFF70FF34, 0xFF70FF35, 0xFF70FF35, 0xFF6FFF35, 0xFF6FFF35, 0xFF6FFF35, 0xFF6EFF36, 
+	0xFF6EFF36, 0xFF6EFF36, 0xFF6DFF36, 0xFF6DFF37, 0xFF6DFF37, 0xFF6DFF37, 0xFF6CFF37, 0xFF6CFF37, 
+	0xFF6CFF38, 0xFF6BFF38, 0xFF6BFF38, 0xFF6BFF38, 0xFF6AFF39, 0xFF6AFF39, 0xFF6AFF39, 0xFF69FF39, 
+	0xFF69FF3A, 0xFF69FF3A, 0xFF69FF3A, 0xFF68FF3A, 0xFF68FF3A, 0xFF68FF3B, 0xFF67FF3B, 0xFF67FF3B, 
+	0xFF67FF3B, 0xFF66FF3C, 0xFF66FF3C, 0xFF66FF3C, 0xFF65FF3C, 0xFF65FF3D, 0xFF65FF3D, 0xFF65FF3D, 
+	0xFF64FF3D, 0xFF64FF3E, 0xFF64FF3E, 0xFF63FF3E, 0xFF63FF3E, 0xFF63FF3F, 0xFF62FF3F, 0xFF62FF3F, 
+	0xFF62FF3F, 0xFF62FF3F, 0xFF61FF40, 0xFF61FF40, 0xFF61FF40, 0xFF60FF40, 0xFF60FF41, 0xFF60FF41, 
+	0xFF60FF41, 0xFF5FFF41, 0xFF5FFF42, 0xFF5FFF42, 0xFF5EFF42, 0xFF5EFF42, 0xFF5EFF43, 0xFF5DFF43, 
+	0xFF5DFF43, 0xFF5DFF43, 0xFF5DFF44, 0xFF5CFF44, 0xFF5CFF44, 0xFF5CFF44, 0xFF5BFF45, 0xFF5BFF45, 
+	0xFF5BFF45, 0xFF5BFF45, 0xFF5AFF46, 0xFF5AFF46, 0xFF5AFF46, 0xFF59FF46, 0xFF59FF47, 0xFF59FF47, 
+	0xFF59FF47, 0xFF58FF48, 0xFF58FF48, 0xFF58FF48, 0xFF57FF48, 0xFF57FF49, 0xFF57FF49, 0xFF57FF49, 
+	0xFF56FF49, 0xFF56FF4A, 0xFF56FF4A, 0xFF56FF4A, 0xFF55FF4A, 0xFF55FF4B, 0xFF55FF4B, 0xFF54FF4B, 
+	0xFF54FF4B, 0xFF54FF4C, 0xFF54FF4C, 0xFF53FF4C, 0xFF53FF4C, 0xFF53FF4D, 0xFF52FF4D, 0xFF52FF4D, 
+	0xFF52FF4E, 0xFF52FF4E, 0xFF51FF4E, 0xFF51FF4E, 0xFF51FF4F, 0xFF51FF4F, 0xFF50FF4F, 0xFF50FF4F, 
+	0xFF50FF50, 0xFF4FFF50, 0xFF4FFF50, 0xFF4FFF51, 0xFF4FFF51, 0xFF4EFF51, 0xFF4EFF51, 0xFF4EFF52, 
+	0xFF4EFF52, 0xFF4DFF52, 0xFF4DFF52, 0xFF4DFF53, 0xFF4CFF53, 0xFF4CFF53, 0xFF4CFF54, 0xFF4CFF54, 
+	0xFF4BFF54, 0xFF4BFF54, 0xFF4BFF55, 0xFF4BFF55, 0xFF4AFF55, 0xFF4AFF56, 0xFF4AFF56, 0xFF4AFF56, 
+	0xFF49FF56, 0xFF49FF57, 0xFF49FF57, 0xFF49FF57, 0xFF48FF57, 0xFF48FF58, 0xFF48FF58, 0xFF48FF58, 
+	0xFF47FF59, 0xFF47FF59, 0xFF47FF59, 0xFF46FF59, 0xFF46FF5A, 0xFF46FF5A, 0xFF46FF5A, 0xFF45FF5B, 
+	0xFF45FF5B, 0xFF45FF5B, 0xFF45FF5B, 0xFF44FF5C, 0xFF44FF5C, 0xFF44FF5C, 0xFF44FF5D, 0xFF43FF5D, 
+	0xFF43FF5D, 0xFF43FF5D, 0xFF43FF5E, 0xFF42FF5E, 0xFF42FF5E, 0xFF42FF5F, 0xFF42FF5F, 0xFF41FF5F, 
+	0xFF41FF60, 0xFF41FF60, 0xFF41FF60, 0xFF40FF60, 0xFF40FF61, 0xFF40FF61, 0xFF40FF61, 0xFF3FFF62, 
+	0xFF3FFF62, 0xFF3FFF62, 0xFF3FFF62, 0xFF3FFF63, 0xFF3EFF63, 0xFF3EFF63, 0xFF3EFF64, 0xFF3EFF64, 
+	0xFF3DFF64, 0xFF3DFF65, 0xFF3DFF65, 0xFF3DFF65, 0xFF3CFF65, 0xFF3CFF66, 0xFF3CFF66, 0xFF3CFF66, 
+	0xFF3BFF67, 0xFF3BFF67, 0xFF3BFF67, 0xFF3BFF68, 0xFF3AFF68, 0xFF3AFF68, 0xFF3AFF69, 0xFF3AFF69, 
+	0xFF3AFF69, 0xFF39FF69, 0xFF39FF6A, 0xFF39FF6A, 0xFF39FF6A, 0xFF38FF6B, 0xFF38FF6B, 0xFF38FF6B, 
+	0xFF38FF6C, 0xFF37FF6C, 0xFF37FF6C, 0xFF37FF6D, 0xFF37FF6D, 0xFF37FF6D, 0xFF36FF6D, 0xFF36FF6E, 
+	0xFF36FF6E, 0xFF36FF6E, 0xFF35FF6F, 0xFF35FF6F, 0xFF35FF6F, 0xFF35FF70, 0xFF35FF70, 0xFF34FF70, 
+	0xFF34FF71, 0xFF34FF71, 0xFF34FF71, 0xFF33FF71, 0xFF33FF72, 0xFF33FF72, 0xFF33FF72, 0xFF33FF73, 
+	0xFF32FF73, 0xFF32FF73, 0xFF32FF74, 0xFF32FF74, 0xFF31FF74, 0xFF31FF75, 0xFF31FF75, 0xFF31FF75, 
+	0xFF31FF76, 0xFF30FF76, 0xFF30FF76, 0xFF30FF77, 0xFF30FF77, 0xFF30FF77, 0xFF2FFF78, 0xFF2FFF78, 
+	0xFF2FFF78, 0xFF2FFF78, 0xFF2FFF79, 0xFF2EFF79, 0xFF2EFF79, 0xFF2EFF7A, 0xFF2EFF7A, 0xFF2DFF7A, 
+	0xFF2DFF7B, 0xFF2DFF7B, 0xFF2DFF7B, 0xFF2DFF7C, 0xFF2CFF7C, 0xFF2CFF7C, 0xFF2CFF7D, 0xFF2CFF7D, 
+	0xFF2CFF7D, 0xFF2BFF7E, 0xFF2BFF7E, 0xFF2BFF7E, 0xFF2BFF7F, 0xFF2BFF7F, 0xFF2AFF7F, 0xFF2AFF80, 
+	0xFF2AFF80, 0xFF2AFF80, 0xFF2AFF81, 0xFF29FF81, 0xFF29FF81, 0xFF29FF82, 0xFF29FF82, 0xFF29FF82, 
+	0xFF29FF83, 0xFF28FF83, 0xFF28FF83, 0xFF28FF84, 0xFF28FF84, 0xFF28FF84, 0xFF27FF85, 0xFF27FF85, 
+	0xFF27FF85, 0xFF27FF86, 0xFF27FF86, 0xFF26FF86, 0xFF26FF87, 0xFF26FF87, 0xFF26FF87, 0xFF26FF88, 
+	0xFF25FF88, 0xFF25FF88, 0xFF25FF89, 0xFF25FF89, 0xFF25FF89, 0xFF25FF8A, 0xFF24FF8A, 0xFF24FF8A, 
+	0xFF24FF8B, 0xFF24FF8B, 0xFF24FF8B, 0xFF23FF8C, 0xFF23FF8C, 0xFF23FF8C, 0xFF23FF8D, 0xFF23FF8D, 
+	0xFF23FF8D, 0xFF22FF8E, 0xFF22FF8E, 0xFF22FF8E, 0xFF22FF8F, 0xFF22FF8F, 0xFF22FF8F, 0xFF21FF90, 
+	0xFF21FF90, 0xFF21FF90, 0xFF21FF91, 0xFF21FF91, 0xFF21FF91, 0xFF20FF92, 0xFF20FF92, 0xFF20FF93, 
+	0xFF20FF93, 0xFF20FF93, 0xFF1FFF94, 0xFF1FFF94, 0xFF1FFF94, 0xFF1FFF95, 0xFF1FFF95, 0xFF1FFF95, 
+	0xFF1FFF96, 0xFF1EFF96, 0xFF1EFF96, 0xFF1EFF97, 0xFF1EFF97, 0xFF1EFF97, 0xFF1EFF98, 0xFF1DFF98, 
+	0xFF1DFF98, 0xFF1DFF99, 0xFF1DFF99, 0xFF1DFF99, 0xFF1DFF9A, 0xFF1CFF9A, 0xFF1CFF9A, 0xFF1CFF9B, 
+	0xFF1CFF9B, 0xFF1CFF9C, 0xFF1CFF9C, 0xFF1BFF9C, 0xFF1BFF9D, 0xFF1BFF9D, 0xFF1BFF9D, 0xFF1BFF9E, 
+	0xFF1BFF9E, 0xFF1BFF9E, 0xFF1AFF9F, 0xFF1AFF9F, 0xFF1AFF9F, 0xFF1AFFA0, 0xFF1AFFA0, 0xFF1AFFA0, 
+	0xFF1AFFA1, 0xFF19FFA1, 0xFF19FFA2, 0xFF19FFA2, 0xFF19FFA2, 0xFF19FFA3, 0xFF19FFA3, 0xFF19FFA3, 
+	0xFF18FFA4, 0xFF18FFA4, 0xFF18FFA4, 0xFF18FFA5, 0xFF18FFA5, 0xFF18FFA5, 0xFF18FFA6, 0xFF17FFA6, 
+	0xFF17FFA7, 0xFF17FFA7, 0xFF17FFA7, 0xFF17FFA8, 0xFF17FFA8, 0xFF17FFA8, 0xFF16FFA9, 0xFF16FFA9, 
+	0xFF16FFA9, 0xFF16FFAA, 0xFF16FFAA, 0xFF16FFAA, 0xFF16FFAB, 0xFF16FFAB, 0xFF15FFAC, 0xFF15FFAC, 
+	0xFF15FFAC, 0xFF15FFAD, 0xFF15FFAD, 0xFF15FFAD, 0xFF15FFAE, 0xFF14FFAE, 0xFF14FFAE, 0xFF14FFAF, 
+	0xFF14FFAF, 0xFF14FFB0, 0xFF14FFB0, 0xFF14FFB0, 0xFF14FFB1, 0xFF13FFB1, 0xFF13FFB1, 0xFF13FFB2, 
+	0xFF13FFB2, 0xFF13FFB2, 0xFF13FFB3, 0xFF13FFB3, 0xFF13FFB4, 0xFF13FFB4, 0xFF12FFB4, 0xFF12FFB5, 
+	0xFF12FFB5, 0xFF12FFB5, 0xFF12FFB6, 0xFF12FFB6, 0xFF12FFB6, 0xFF12FFB7, 0xFF11FFB7, 0xFF11FFB8, 
+	0xFF11FFB8, 0xFF11FFB8, 0xFF11FFB9, 0xFF11FFB9, 0xFF11FFB9, 0xFF11FFBA, 0xFF11FFBA, 0xFF10FFBB, 
+	0xFF10FFBB, 0xFF10FFBB, 0xFF10FFBC, 0xFF10FFBC, 0xFF10FFBC, 0xFF10FFBD, 0xFF10FFBD, 0xFF10FFBD, 
+	0xFF10FFBE, 0xFF0FFFBE, 0xFF0FFFBF, 0xFF0FFFBF, 0xFF0FFFBF, 0xFF0FFFC0, 0xFF0FFFC0, 0xFF0FFFC0, 
+	0xFF0FFFC1, 0xFF0FFFC1, 0xFF0FFFC2, 0xFF0EFFC2, 0xFF0EFFC2, 0xFF0EFFC3, 0xFF0EFFC3, 0xFF0EFFC3, 
+	0xFF0EFFC4, 0xFF0EFFC4, 0xFF0EFFC4, 0xFF0EFFC5, 0xFF0EFFC5, 0xFF0EFFC6, 0xFF0DFFC6, 0xFF0DFFC6, 
+	0xFF0DFFC7, 0xFF0DFFC7, 0xFF0DFFC7, 0xFF0DFFC8, 0xFF0DFFC8, 0xFF0DFFC9, 0xFF0DFFC9, 0xFF0DFFC9, 
+	0xFF0DFFCA, 0xFF0CFFCA, 0xFF0CFFCA, 0xFF0CFFCB, 0xFF0CFFCB, 0xFF0CFFCC, 0xFF0CFFCC, 0xFF0CFFCC, 
+	0xFF0CFFCD, 0xFF0CFFCD, 0xFF0CFFCD, 0xFF0CFFCE, 0xFF0CFFCE, 0xFF0CFFCF, 0xFF0BFFCF, 0xFF0BFFCF, 
+	0xFF0BFFD0, 0xFF0BFFD0, 0xFF0BFFD0, 0xFF0BFFD1, 0xFF0BFFD1, 0xFF0BFFD2, 0xFF0BFFD2, 0xFF0BFFD2, 
+	0xFF0BFFD3, 0xFF0BFFD3, 0xFF0BFFD3, 0xFF0BFFD4, 0xFF0AFFD4, 0xFF0AFFD5, 0xFF0AFFD5, 0xFF0AFFD5, 
+	0xFF0AFFD6, 0xFF0AFFD6, 0xFF0AFFD7, 0xFF0AFFD7, 0xFF0AFFD7, 0xFF0AFFD8, 0xFF0AFFD8, 0xFF0AFFD8, 
+	0xFF0AFFD9, 0xFF0AFFD9, 0xFF0AFFDA, 0xFF09FFDA, 0xFF09FFDA, 0xFF09FFDB, 0xFF09FFDB, 0xFF09FFDB, 
+	0xFF09FFDC, 0xFF09FFDC, 0xFF09FFDD, 0xFF09FFDD, 0xFF09FFDD, 0xFF09FFDE, 0xFF09FFDE, 0xFF09FFDE, 
+	0xFF09FFDF, 0xFF09FFDF, 0xFF09FFE0, 0xFF09FFE0, 0xFF09FFE0, 0xFF09FFE1, 0xFF08FFE1, 0xFF08FFE2, 
+	0xFF08FFE2, 0xFF08FFE2, 0xFF08FFE3, 0xFF08FFE3, 0xFF08FFE3, 0xFF08FFE4, 0xFF08FFE4, 0xFF08FFE5, 
+	0xFF08FFE5, 0xFF08FFE5, 0xFF08FFE6, 0xFF08FFE6, 0xFF08FFE6, 0xFF08FFE7, 0xFF08FFE7, 0xFF08FFE8, 
+	0xFF08FFE8, 0xFF08FFE8, 0xFF08FFE9, 0xFF08FFE9, 0xFF08FFEA, 0xFF08FFEA, 0xFF07FFEA, 0xFF07FFEB, 
+	0xFF07FFEB, 0xFF07FFEB, 0xFF07FFEC, 0xFF07FFEC, 0xFF07FFED, 0xFF07FFED, 0xFF07FFED, 0xFF07FFEE, 
+	0xFF07FFEE, 0xFF07FFEE, 0xFF07FFEF, 0xFF07FFEF, 0xFF07FFF0, 0xFF07FFF0, 0xFF07FFF0, 0xFF07FFF1, 
+	0xFF07FFF1, 0xFF07FFF2, 0xFF07FFF2, 0xFF07FFF2, 0xFF07FFF3, 0xFF07FFF3, 0xFF07FFF3, 0xFF07FFF4, 
+	0xFF07FFF4, 0xFF07FFF5, 0xFF07FFF5, 0xFF07FFF5, 0xFF07FFF6, 0xFF07FFF6, 0xFF07FFF7, 0xFF07FFF7, 
+	0xFF07FFF7, 0xFF07FFF8, 0xFF07FFF8, 0xFF07FFF8, 0xFF07FFF9, 0xFF07FFF9, 0xFF07FFFA, 0xFF07FFFA, 
+	0xFF07FFFA, 0xFF07FFFB, 0xFF07FFFB, 0xFF07FFFC, 0xFF07FFFC, 0xFF07FFFC, 0xFF07FFFD, 0xFF07FFFD, 
+	0xFF07FFFD, 0xFF07FFFE, 0xFF07FFFE, 0xFF07FFFF, 0xFF07FFFF, 0xFF07FFFF, 0xFF070000, 0xFF070000, 
+	0xFF060000, 0xFF070000, 0xFF070000, 0xFF070001, 0xFF070001, 0xFF070001, 0xFF070002, 0xFF070002, 
+	0xFF070003, 0xFF070003, 0xFF070003, 0xFF070004, 0xFF070004, 0xFF070004, 0xFF070005, 0xFF070005, 
+	0xFF070006, 0xFF070006, 0xFF070006, 0xFF070007, 0xFF070007, 0xFF070008, 0xFF070008, 0xFF070008, 
+	0xFF070009, 0xFF070009, 0xFF070009, 0xFF07000A, 0xFF07000A, 0xFF07000B, 0xFF07000B, 0xFF07000B, 
+	0xFF07000C, 0xFF07000C, 0xFF07000D, 0xFF07000D, 0xFF07000D, 0xFF07000E, 0xFF07000E, 0xFF07000E, 
+	0xFF07000F, 0xFF07000F, 0xFF070010, 0xFF070010, 0xFF070010, 0xFF070011, 0xFF070011, 0xFF070012, 
+	0xFF070012, 0xFF070012, 0xFF070013, 0xFF070013, 0xFF070013, 0xFF070014, 0xFF070014, 0xFF070015, 
+	0xFF070015, 0xFF070015, 0xFF070016, 0xFF080016, 0xFF080016, 0xFF080017, 0xFF080017, 0xFF080018, 
+	0xFF080018, 0xFF080018, 0xFF080019, 0xFF080019, 0xFF08001A, 0xFF08001A, 0xFF08001A, 0xFF08001B, 
+	0xFF08001B, 0xFF08001B, 0xFF08001C, 0xFF08001C, 0xFF08001D, 0xFF08001D, 0xFF08001D, 0xFF08001E, 
+	0xFF08001E, 0xFF08001E, 0xFF08001F, 0xFF09001F, 0xFF090020, 0xFF090020, 0xFF090020, 0xFF090021, 
+	0xFF090021, 0xFF090022, 0xFF090022, 0xFF090022, 0xFF090023, 0xFF090023, 0xFF090023, 0xFF090024, 
+	0xFF090024, 0xFF090025, 0xFF090025, 0xFF090025, 0xFF090026, 0xFF090026, 0xFF0A0026, 0xFF0A0027, 
+	0xFF0A0027, 0xFF0A0028, 0xFF0A0028, 0xFF0A0028, 0xFF0A0029, 0xFF0A0029, 0xFF0A0029, 0xFF0A002A, 
+	0xFF0A002A, 0xFF0A002B, 0xFF0A002B, 0xFF0A002B, 0xFF0A002C, 0xFF0B002C, 0xFF0B002D, 0xFF0B002D, 
+	0xFF0B002D, 0xFF0B002E, 0xFF0B002E, 0xFF0B002E, 0xFF0B002F, 0xFF0B002F, 0xFF0B0030, 0xFF0B0030, 
+	0xFF0B0030, 0xFF0B0031, 0xFF0B0031, 0xFF0C0031, 0xFF0C0032, 0xFF0C0032, 0xFF0C0033, 0xFF0C0033, 
+	0xFF0C0033, 0xFF0C0034, 0xFF0C0034, 0xFF0C0034, 0xFF0C0035, 0xFF0C0035, 0xFF0C0036, 0xFF0C0036, 
+	0xFF0D0036, 0xFF0D0037, 0xFF0D0037, 0xFF0D0037, 0xFF0D0038, 0xFF0D0038, 0xFF0D0039, 0xFF0D0039, 
+	0xFF0D0039, 0xFF0D003A, 0xFF0D003A, 0xFF0E003A, 0xFF0E003B, 0xFF0E003B, 0xFF0E003C, 0xFF0E003C, 
+	0xFF0E003C, 0xFF0E003D, 0xFF0E003D, 0xFF0E003D, 0xFF0E003E, 0xFF0E003E, 0xFF0F003E, 0xFF0F003F, 
+	0xFF0F003F, 0xFF0F0040, 0xFF0F0040, 0xFF0F0040, 0xFF0F0041, 0xFF0F0041, 0xFF0F0041, 0xFF0F0042, 
+	0xFF100042, 0xFF100043, 0xFF100043, 0xFF100043, 0xFF100044, 0xFF100044, 0xFF100044, 0xFF100045, 
+	0xFF100045, 0xFF100045, 0xFF110046, 0xFF110046, 0xFF110047, 0xFF110047, 0xFF110047, 0xFF110048, 
+	0xFF110048, 0xFF110048, 0xFF110049, 0xFF120049, 0xFF12004A, 0xFF12004A, 0xFF12004A, 0xFF12004B, 
+	0xFF12004B, 0xFF12004B, 0xFF12004C, 0xFF13004C, 0xFF13004C, 0xFF13004D, 0xFF13004D, 0xFF13004E, 
+	0xFF13004E, 0xFF13004E, 0xFF13004F, 0xFF13004F, 0xFF14004F, 0xFF140050, 0xFF140050, 0xFF140050, 
+	0xFF140051, 0xFF140051, 0xFF140052, 0xFF140052, 0xFF150052, 0xFF150053, 0xFF150053, 0xFF150053, 
+	0xFF150054, 0xFF150054, 0xFF150054, 0xFF160055, 0xFF160055, 0xFF160056, 0xFF160056, 0xFF160056, 
+	0xFF160057, 0xFF160057, 0xFF160057, 0xFF170058, 0xFF170058, 0xFF170058, 0xFF170059, 0xFF170059, 
+	0xFF170059, 0xFF17005A, 0xFF18005A, 0xFF18005B, 0xFF18005B, 0xFF18005B, 0xFF18005C, 0xFF18005C, 
+	0xFF18005C, 0xFF19005D, 0xFF19005D, 0xFF19005D, 0xFF19005E, 0xFF19005E, 0xFF19005E, 0xFF19005F, 
+	0xFF1A005F, 0xFF1A0060, 0xFF1A0060, 0xFF1A0060, 0xFF1A0061, 0xFF1A0061, 0xFF1A0061, 0xFF1B0062, 
+	0xFF1B0062, 0xFF1B0062, 0xFF1B0063, 0xFF1B0063, 0xFF1B0063, 0xFF1B0064, 0xFF1C0064, 0xFF1C0064, 
+	0xFF1C0065, 0xFF1C0065, 0xFF1C0066, 0xFF1C0066, 0xFF1D0066, 0xFF1D0067, 0xFF1D0067, 0xFF1D0067, 
+	0xFF1D0068, 0xFF1D0068, 0xFF1E0068, 0xFF1E0069, 0xFF1E0069, 0xFF1E0069, 0xFF1E006A, 0xFF1E006A, 
+	0xFF1F006A, 0xFF1F006B, 0xFF1F006B, 0xFF1F006B, 0xFF1F006C, 0xFF1F006C, 0xFF1F006C, 0xFF20006D, 
+	0xFF20006D, 0xFF20006D, 0xFF20006E, 0xFF20006E, 0xFF21006F, 0xFF21006F, 0xFF21006F, 0xFF210070, 
+	0xFF210070, 0xFF210070, 0xFF220071, 0xFF220071, 0xFF220071, 0xFF220072, 0xFF220072, 0xFF220072, 
+	0xFF230073, 0xFF230073, 0xFF230073, 0xFF230074, 0xFF230074, 0xFF230074, 0xFF240075, 0xFF240075, 
+	0xFF240075, 0xFF240076, 0xFF240076, 0xFF250076, 0xFF250077, 0xFF250077, 0xFF250077, 0xFF250078, 
+	0xFF250078, 0xFF260078, 0xFF260079, 0xFF260079, 0xFF260079, 0xFF26007A, 0xFF27007A, 0xFF27007A, 
+	0xFF27007B, 0xFF27007B, 0xFF27007B, 0xFF28007C, 0xFF28007C, 0xFF28007C, 0xFF28007D, 0xFF28007D, 
+	0xFF29007D, 0xFF29007E, 0xFF29007E, 0xFF29007E, 0xFF29007F, 0xFF29007F, 0xFF2A007F, 0xFF2A0080, 
+	0xFF2A0080, 0xFF2A0080, 0xFF2A0081, 0xFF2B0081, 0xFF2B0081, 0xFF2B0082, 0xFF2B0082, 0xFF2B0082, 
+	0xFF2C0083, 0xFF2C0083, 0xFF2C0083, 0xFF2C0084, 0xFF2C0084, 0xFF2D0084, 0xFF2D0085, 0xFF2D0085, 
+	0xFF2D0085, 0xFF2D0086, 0xFF2E0086, 0xFF2E0086, 0xFF2E0087, 0xFF2E0087, 0xFF2F0087, 0xFF2F0088, 
+	0xFF2F0088, 0xFF2F0088, 0xFF2F0088, 0xFF300089, 0xFF300089, 0xFF300089, 0xFF30008A, 0xFF30008A, 
+	0xFF31008A, 0xFF31008B, 0xFF31008B, 0xFF31008B, 0xFF31008C, 0xFF32008C, 0xFF32008C, 0xFF32008D, 
+	0xFF32008D, 0xFF33008D, 0xFF33008E, 0xFF33008E, 0xFF33008E, 0xFF33008F, 0xFF34008F, 0xFF34008F, 
+	0xFF34008F, 0xFF340090, 0xFF350090, 0xFF350090, 0xFF350091, 0xFF350091, 0xFF350091, 0xFF360092, 
+	0xFF360092, 0xFF360092, 0xFF360093, 0xFF370093, 0xFF370093, 0xFF370093, 0xFF370094, 0xFF370094, 
+	0xFF380094, 0xFF380095, 0xFF380095, 0xFF380095, 0xFF390096, 0xFF390096, 0xFF390096, 0xFF390097, 
+	0xFF3A0097, 0xFF3A0097, 0xFF3A0097, 0xFF3A0098, 0xFF3A0098, 0xFF3B0098, 0xFF3B0099, 0xFF3B0099, 
+	0xFF3B0099, 0xFF3C009A, 0xFF3C009A, 0xFF3C009A, 0xFF3C009B, 0xFF3D009B, 0xFF3D009B, 0xFF3D009B, 
+	0xFF3D009C, 0xFF3E009C, 0xFF3E009C, 0xFF3E009D, 0xFF3E009D, 0xFF3F009D, 0xFF3F009E, 0xFF3F009E, 
+	0xFF3F009E, 0xFF3F009E, 0xFF40009F, 0xFF40009F, 0xFF40009F, 0xFF4000A0, 0xFF4100A0, 0xFF4100A0, 
+	0xFF4100A0, 0xFF4100A1, 0xFF4200A1, 0xFF4200A1, 0xFF4200A2, 0xFF4200A2, 0xFF4300A2, 0xFF4300A3, 
+	0xFF4300A3, 0xFF4300A3, 0xFF4400A3, 0xFF4400A4, 0xFF4400A4, 0xFF4400A4, 0xFF4500A5, 0xFF4500A5, 
+	0xFF4500A5, 0xFF4500A5, 0xFF4600A6, 0xFF4600A6, 0xFF4600A6, 0xFF4600A7, 0xFF4700A7, 0xFF4700A7, 
+	0xFF4700A7, 0xFF4800A8, 0xFF4800A8, 0xFF4800A8, 0xFF4800A9, 0xFF4900A9, 0xFF4900A9, 0xFF4900A9, 
+	0xFF4900AA, 0xFF4A00AA, 0xFF4A00AA, 0xFF4A00AA, 0xFF4A00AB, 0xFF4B00AB, 0xFF4B00AB, 0xFF4B00AC, 
+	0xFF4B00AC, 0xFF4C00AC, 0xFF4C00AC, 0xFF4C00AD, 0xFF4C00AD, 0xFF4D00AD, 0xFF4D00AE, 0xFF4D00AE, 
+	0xFF4E00AE, 0xFF4E00AE, 0xFF4E00AF, 0xFF4E00AF, 0xFF4F00AF, 0xFF4F00AF, 0xFF4F00B0, 0xFF4F00B0, 
+	0xFF5000B0, 0xFF5000B1, 0xFF5000B1, 0xFF5100B1, 0xFF5100B1, 0xFF5100B2, 0xFF5100B2, 0xFF5200B2, 
+	0xFF5200B2, 0xFF5200B3, 0xFF5200B3, 0xFF5300B3, 0xFF5300B4, 0xFF5300B4, 0xFF5400B4, 0xFF5400B4, 
+	0xFF5400B5, 0xFF5400B5, 0xFF5500B5, 0xFF5500B5, 0xFF5500B6, 0xFF5600B6, 0xFF5600B6, 0xFF5600B6, 
+	0xFF5600B7, 0xFF5700B7, 0xFF5700B7, 0xFF5700B7, 0xFF5700B8, 0xFF5800B8, 0xFF5800B8, 0xFF5800B8, 
+	0xFF5900B9, 0xFF5900B9, 0xFF5900B9, 0xFF5900BA, 0xFF5A00BA, 0xFF5A00BA, 0xFF5A00BA, 0xFF5B00BB, 
+	0xFF5B00BB, 0xFF5B00BB, 0xFF5B00BB, 0xFF5C00BC, 0xFF5C00BC, 0xFF5C00BC, 0xFF5D00BC, 0xFF5D00BD, 
+	0xFF5D00BD, 0xFF5D00BD, 0xFF5E00BD, 0xFF5E00BE, 0xFF5E00BE, 0xFF5F00BE, 0xFF5F00BE, 0xFF5F00BF, 
+	0xFF6000BF, 0xFF6000BF, 0xFF6000BF, 0xFF6000C0, 0xFF6100C0, 0xFF6100C0, 0xFF6100C0, 0xFF6200C1, 
+	0xFF6200C1, 0xFF6200C1, 0xFF6200C1, 0xFF6300C1, 0xFF6300C2, 0xFF6300C2, 0xFF6400C2, 0xFF6400C2, 
+	0xFF6400C3, 0xFF6500C3, 0xFF6500C3, 0xFF6500C3, 0xFF6500C4, 0xFF6600C4, 0xFF6600C4, 0xFF6600C4, 
+	0xFF6700C5, 0xFF6700C5, 0xFF6700C5, 0xFF6800C5, 0xFF6800C6, 0xFF6800C6, 0xFF6900C6, 0xFF6900C6, 
+	0xFF6900C6, 0xFF6900C7, 0xFF6A00C7, 0xFF6A00C7, 0xFF6A00C7, 0xFF6B00C8, 0xFF6B00C8, 0xFF6B00C8, 
+	0xFF6C00C8, 0xFF6C00C9, 0xFF6C00C9, 0xFF6D00C9, 0xFF6D00C9, 0xFF6D00C9, 0xFF6D00CA, 0xFF6E00CA, 
+	0xFF6E00CA, 0xFF6E00CA, 0xFF6F00CB, 0xFF6F00CB, 0xFF6F00CB, 0xFF7000CB, 0xFF7000CB, 0xFF7000CC, 
+	0xFF7100CC, 0xFF7100CC, 0xFF7100CC, 0xFF7100CD, 0xFF7200CD, 0xFF7200CD, 0xFF7200CD, 0xFF7300CD, 
+	0xFF7300CE, 0xFF7300CE, 0xFF7400CE, 0xFF7400CE, 0xFF7400CF, 0xFF7500CF, 0xFF7500CF, 0xFF7500CF, 
+	0xFF7600CF, 0xFF7600D0, 0xFF7600D0, 0xFF7700D0, 0xFF7700D0, 0xFF7700D0, 0xFF7800D1, 0xFF7800D1, 
+	0xFF7800D1, 0xFF7800D1, 0xFF7900D1, 0xFF7900D2, 0xFF7900D2, 0xFF7A00D2, 0xFF7A00D2, 0xFF7A00D3, 
+	0xFF7B00D3, 0xFF7B00D3, 0xFF7B00D3, 0xFF7C00D3, 0xFF7C00D4, 0xFF7C00D4, 0xFF7D00D4, 0xFF7D00D4, 
+	0xFF7D00D4, 0xFF7E00D5, 0xFF7E00D5, 0xFF7E00D5, 0xFF7F00D5, 0xFF7F00D5, 0xFF7F00D6, 0xFF8000D6, 
+	0xFF8000D6, 0xFF8000D6, 0xFF8100D6, 0xFF8100D7, 0xFF8100D7, 0xFF8200D7, 0xFF8200D7, 0xFF8200D7, 
+	0xFF8300D7, 0xFF8300D8, 0xFF8300D8, 0xFF8400D8, 0xFF8400D8, 0xFF8400D8, 0xFF8500D9, 0xFF8500D9, 
+	0xFF8500D9, 0xFF8600D9, 0xFF8600D9, 0xFF8600DA, 0xFF8700DA, 0xFF8700DA, 0xFF8700DA, 0xFF8800DA, 
+	0xFF8800DB, 0xFF8800DB, 0xFF8900DB, 0xFF8900DB, 0xFF8900DB, 0xFF8A00DB, 0xFF8A00DC, 0xFF8A00DC, 
+	0xFF8B00DC, 0xFF8B00DC, 0xFF8B00DC, 0xFF8C00DD, 0xFF8C00DD, 0xFF8C00DD, 0xFF8D00DD, 0xFF8D00DD, 
+	0xFF8D00DD, 0xFF8E00DE, 0xFF8E00DE, 0xFF8E00DE, 0xFF8F00DE, 0xFF8F00DE, 0xFF8F00DE, 0xFF9000DF, 
+	0xFF9000DF, 0xFF9000DF, 0xFF9100DF, 0xFF9100DF, 0xFF9100DF, 0xFF9200E0, 0xFF9200E0, 0xFF9300E0, 
+	0xFF9300E0, 0xFF9300E0, 0xFF9400E1, 0xFF9400E1, 0xFF9400E1, 0xFF9500E1, 0xFF9500E1, 0xFF9500E1, 
+	0xFF9600E1, 0xFF9600E2, 0xFF9600E2, 0xFF9700E2, 0xFF9700E2, 0xFF9700E2, 0xFF9800E2, 0xFF9800E3, 
+	0xFF9800E3, 0xFF9900E3, 0xFF9900E3, 0xFF9900E3, 0xFF9A00E3, 0xFF9A00E4, 0xFF9A00E4, 0xFF9B00E4, 
+	0xFF9B00E4, 0xFF9C00E4, 0xFF9C00E4, 0xFF9C00E5, 0xFF9D00E5, 0xFF9D00E5, 0xFF9D00E5, 0xFF9E00E5, 
+	0xFF9E00E5, 0xFF9E00E5, 0xFF9F00E6, 0xFF9F00E6, 0xFF9F00E6, 0xFFA000E6, 0xFFA000E6, 0xFFA000E6, 
+	0xFFA100E6, 0xFFA100E7, 0xFFA200E7, 0xFFA200E7, 0xFFA200E7, 0xFFA300E7, 0xFFA300E7, 0xFFA300E7, 
+	0xFFA400E8, 0xFFA400E8, 0xFFA400E8, 0xFFA500E8, 0xFFA500E8, 0xFFA500E8, 0xFFA600E8, 0xFFA600E9, 
+	0xFFA700E9, 0xFFA700E9, 0xFFA700E9, 0xFFA800E9, 0xFFA800E9, 0xFFA800E9, 0xFFA900EA, 0xFFA900EA, 
+	0xFFA900EA, 0xFFAA00EA, 0xFFAA00EA, 0xFFAA00EA, 0xFFAB00EA, 0xFFAB00EA, 0xFFAC00EB, 0xFFAC00EB, 
+	0xFFAC00EB, 0xFFAD00EB, 0xFFAD00EB, 0xFFAD00EB, 0xFFAE00EB, 0xFFAE00EC, 0xFFAE00EC, 0xFFAF00EC, 
+	0xFFAF00EC, 0xFFB000EC, 0xFFB000EC, 0xFFB000EC, 0xFFB100EC, 0xFFB100ED, 0xFFB100ED, 0xFFB200ED, 
+	0xFFB200ED, 0xFFB200ED, 0xFFB300ED, 0xFFB300ED, 0xFFB400ED, 0xFFB400ED, 0xFFB400EE, 0xFFB500EE, 
+	0xFFB500EE, 0xFFB500EE, 0xFFB600EE, 0xFFB600EE, 0xFFB600EE, 0xFFB700EE, 0xFFB700EF, 0xFFB800EF, 
+	0xFFB800EF, 0xFFB800EF, 0xFFB900EF, 0xFFB900EF, 0xFFB900EF, 0xFFBA00EF, 0xFFBA00EF, 0xFFBB00F0, 
+	0xFFBB00F0, 0xFFBB00F0, 0xFFBC00F0, 0xFFBC00F0, 0xFFBC00F0, 0xFFBD00F0, 0xFFBD00F0, 0xFFBD00F0, 
+	0xFFBE00F0, 0xFFBE00F1, 0xFFBF00F1, 0xFFBF00F1, 0xFFBF00F1, 0xFFC000F1, 0xFFC000F1, 0xFFC000F1, 
+	0xFFC100F1, 0xFFC100F1, 0xFFC200F1, 0xFFC200F2, 0xFFC200F2, 0xFFC300F2, 0xFFC300F2, 0xFFC300F2, 
+	0xFFC400F2, 0xFFC400F2, 0xFFC400F2, 0xFFC500F2, 0xFFC500F2, 0xFFC600F2, 0xFFC600F3, 0xFFC600F3, 
+	0xFFC700F3, 0xFFC700F3, 0xFFC700F3, 0xFFC800F3, 0xFFC800F3, 0xFFC900F3, 0xFFC900F3, 0xFFC900F3, 
+	0xFFCA00F3, 0xFFCA00F4, 0xFFCA00F4, 0xFFCB00F4, 0xFFCB00F4, 0xFFCC00F4, 0xFFCC00F4, 0xFFCC00F4, 
+	0xFFCD00F4, 0xFFCD00F4, 0xFFCD00F4, 0xFFCE00F4, 0xFFCE00F4, 0xFFCF00F4, 0xFFCF00F5, 0xFFCF00F5, 
+	0xFFD000F5, 0xFFD000F5, 0xFFD000F5, 0xFFD100F5, 0xFFD100F5, 0xFFD200F5, 0xFFD200F5, 0xFFD200F5, 
+	0xFFD300F5, 0xFFD300F5, 0xFFD300F5, 0xFFD400F5, 0xFFD400F6, 0xFFD500F6, 0xFFD500F6, 0xFFD500F6, 
+	0xFFD600F6, 0xFFD600F6, 0xFFD700F6, 0xFFD700F6, 0xFFD700F6, 0xFFD800F6, 0xFFD800F6, 0xFFD800F6, 
+	0xFFD900F6, 0xFFD900F6, 0xFFDA00F6, 0xFFDA00F7, 0xFFDA00F7, 0xFFDB00F7, 0xFFDB00F7, 0xFFDB00F7, 
+	0xFFDC00F7, 0xFFDC00F7, 0xFFDD00F7, 0xFFDD00F7, 0xFFDD00F7, 0xFFDE00F7, 0xFFDE00F7, 0xFFDE00F7, 
+	0xFFDF00F7, 0xFFDF00F7, 0xFFE000F7, 0xFFE000F7, 0xFFE000F7, 0xFFE100F7, 0xFFE100F8, 0xFFE200F8, 
+	0xFFE200F8, 0xFFE200F8, 0xFFE300F8, 0xFFE300F8, 0xFFE300F8, 0xFFE400F8, 0xFFE400F8, 0xFFE500F8, 
+	0xFFE500F8, 0xFFE500F8, 0xFFE600F8, 0xFFE600F8, 0xFFE600F8, 0xFFE700F8, 0xFFE700F8, 0xFFE800F8, 
+	0xFFE800F8, 0xFFE800F8, 0xFFE900F8, 0xFFE900F8, 0xFFEA00F8, 0xFFEA00F8, 0xFFEA00F9, 0xFFEB00F9, 
+	0xFFEB00F9, 0xFFEB00F9, 0xFFEC00F9, 0xFFEC00F9, 0xFFED00F9, 0xFFED00F9, 0xFFED00F9, 0xFFEE00F9, 
+	0xFFEE00F9, 0xFFEE00F9, 0xFFEF00F9, 0xFFEF00F9, 0xFFF000F9, 0xFFF000F9, 0xFFF000F9, 0xFFF100F9, 
+	0xFFF100F9, 0xFFF200F9, 0xFFF200F9, 0xFFF200F9, 0xFFF300F9, 0xFFF300F9, 0xFFF300F9, 0xFFF400F9, 
+	0xFFF400F9, 0xFFF500F9, 0xFFF500F9, 0xFFF500F9, 0xFFF600F9, 0xFFF600F9, 0xFFF700F9, 0xFFF700F9, 
+	0xFFF700F9, 0xFFF800F9, 0xFFF800F9, 0xFFF800F9, 0xFFF900F9, 0xFFF900F9, 0xFFFA00F9, 0xFFFA00F9, 
+	0xFFFA00F9, 0xFFFB00F9, 0xFFFB00F9, 0xFFFC00F9, 0xFFFC00F9, 0xFFFC00F9, 0xFFFD00F9, 0xFFFD00F9, 
+	0xFFFD00F9, 0xFFFE00F9, 0xFFFE00F9, 0xFFFF00F9, 0xFFFF00F9, 0xFFFF00F9, 0x000000F9, 0x000000F9, 
+	0x000000FA, 
+};
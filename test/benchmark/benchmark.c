@@ -0,0 +1,499 @@
+// Needed for clock_gettime(), dup() and dup2() under -std=c99
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#include "../../libs/rtklib-2.4.3/src/rtklib.h"
+
+#include "../../include/simulator.h"
+#include "../../include/synthesis.h"
+#include "../../include/mixer.h"
+#include "../../include/codetables.h"
+#include "../../include/orbits.h"
+#include "../../include/navmessage.h"
+
+// Microbenchmarks for the simulator's hot paths (build with "make benchmark" in src/)
+// Usage: gnss-sim-benchmark [-e ephemerides] [-j results.json] [-t threads] [-v NAME=value]...
+// NOTES:
+// 1. Each benchmark is repeated, doubling the repeat count, until it has run for at least BENCHMARK_MIN_DURATION_S.
+//    Rates are the work done divided by the wall clock time of that last run.
+// 2. The synthesis benchmarks are swept over BENCHMARK_CHANNEL_COUNTS and BENCHMARK_WINDOWS_S at the scenario's sample
+//    rate (set with -v like gnss-sim). Their channels are synthetic (fixed Doppler, no geometry updates), so they time
+//    synthesizeWindow() alone. The simulate benchmarks time the whole loop, geometry and output pipeline included.
+// 3. The simulator's console output is sent to /dev/null while it runs. simulate() still appends to channel-dump.txt.
+// 4. Results are printed as they're measured and, with -j, written out as JSON for comparing between builds.
+
+#define BENCHMARK_MIN_DURATION_S    (0.5)
+#define BENCHMARK_MAX_RESULTS       (64)
+#define BENCHMARK_MAX_SV_COUNT      (32)
+#define BENCHMARK_SIMULATE_S        (2.0)
+
+static const int BENCHMARK_CHANNEL_COUNTS[] = { 1, 4, 8, 12, 16 };
+static const double BENCHMARK_WINDOWS_S[] = { 0.01, 0.1 };
+
+#define CHANNEL_COUNT_COUNT (int)(sizeof(BENCHMARK_CHANNEL_COUNTS) / sizeof(BENCHMARK_CHANNEL_COUNTS[0]))
+#define WINDOW_COUNT (int)(sizeof(BENCHMARK_WINDOWS_S) / sizeof(BENCHMARK_WINDOWS_S[0]))
+
+typedef struct {
+    const char* name;
+    const char* unit;
+    int channelCount;
+    int windowSampleCount;
+    double rate;
+} BenchmarkResult;
+
+// Runs iterations repeats of the benchmark and returns how many units of work (samples, words, ...) they did
+typedef double (*BenchmarkFunction)(void* context, long iterations);
+
+static BenchmarkResult Results[BENCHMARK_MAX_RESULTS];
+static int ResultCount;
+
+static eph_t Ephemerides[BENCHMARK_MAX_SV_COUNT];
+static int EphemerisCount;
+
+static const char* KernelNames[] = {
+    [SYNTHESIS_KERNEL_REFERENCE] = "REFERENCE",
+    [SYNTHESIS_KERNEL_BLOCK] = "BLOCK",
+    [SYNTHESIS_KERNEL_NCO] = "NCO",
+    [SYNTHESIS_KERNEL_TABLE] = "TABLE"
+};
+
+static double monotonicTime_s(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return now.tv_sec + (now.tv_nsec * 1e-9);
+}
+
+// Send stdout and stderr to /dev/null (silence = true) and back again (see note 3)
+static void silenceOutput(bool silence) {
+    static int savedStdout = -1;
+    static int savedStderr = -1;
+
+    fflush(stdout);
+    fflush(stderr);
+
+    if (silence) {
+        int nullOutput = open("/dev/null", O_WRONLY);
+
+        savedStdout = dup(STDOUT_FILENO);
+        savedStderr = dup(STDERR_FILENO);
+        dup2(nullOutput, STDOUT_FILENO);
+        dup2(nullOutput, STDERR_FILENO);
+        close(nullOutput);
+    }
+
+    else {
+        dup2(savedStdout, STDOUT_FILENO);
+        dup2(savedStderr, STDERR_FILENO);
+        close(savedStdout);
+        close(savedStderr);
+    }
+}
+
+// Time a benchmark (see note 1) and record its rate
+static void runBenchmark(const char* name, const char* unit, int channelCount, int windowSampleCount, BenchmarkFunction benchmark, void* context) {
+    double work = 0;
+    double elapsed_s = 0;
+
+    for (long iterations = 1; elapsed_s < BENCHMARK_MIN_DURATION_S; iterations *= 2) {
+        double start_s = monotonicTime_s();
+        work = benchmark(context, iterations);
+        elapsed_s = monotonicTime_s() - start_s;
+    }
+
+    BenchmarkResult result = { name, unit, channelCount, windowSampleCount, (work / elapsed_s) };
+
+    if (ResultCount < BENCHMARK_MAX_RESULTS) {
+        Results[ResultCount++] = result;
+    }
+
+    printf("%-30s %3i CHANNELS %8i SAMPLES/WINDOW %14.4g %s\n", name, channelCount, windowSampleCount, result.rate, unit);
+}
+
+// Keep only the newest ephemeris for each GPS SV (as loadEphemerides() in main.c does)
+static int compareEphemerides(const void* p1, const void* p2) {
+    const eph_t* q1 = (const eph_t*)p1;
+    const eph_t* q2 = (const eph_t*)p2;
+
+    if (q1->sat != q2->sat) {
+        return q1->sat - q2->sat;
+    }
+
+    return (int)(q2->toe.time - q1->toe.time);
+}
+
+static int loadBenchmarkEphemerides(char* filename) {
+    nav_t nav = {0};
+
+    if (!readrnx(filename, 0, "-SYS=G", NULL, &nav, NULL) || (nav.n == 0)) {
+        printf("Error: Could not open ephemerides file %s\n", filename);
+        return -1;
+    }
+
+    qsort(nav.eph, nav.n, sizeof(eph_t), compareEphemerides);
+    EphemerisCount = 0;
+
+    for (int i = 0; (i < nav.n) && (EphemerisCount < BENCHMARK_MAX_SV_COUNT); i++) {
+        if ((EphemerisCount == 0) || (nav.eph[i].sat != Ephemerides[EphemerisCount - 1].sat)) {
+            Ephemerides[EphemerisCount++] = nav.eph[i];
+        }
+    }
+
+    free(nav.eph);
+
+    return 0;
+}
+
+// The time simulate() would start at for these ephemerides, on a frame boundary
+static gtime_t benchmarkStartTime(void) {
+    int wn;
+    double tow_s = time2gpst(Ephemerides[0].toc, &wn);
+
+    return gpst2time(wn, (floor(tow_s / (SUBFRAME_DURATION_S * SUBFRAME_COUNT)) * (SUBFRAME_DURATION_S * SUBFRAME_COUNT)));
+}
+
+// Give each channel its own SV and a fixed Doppler, and start its NAV frame and NCOs at time
+static void setupChannels(SV* svs, Channel* channels, int channelCount, gtime_t time) {
+    for (int i = 0; i < channelCount; i++) {
+        SV* sv = &svs[i];
+        Channel* channel = &channels[i];
+
+        memset(sv, 0, sizeof(*sv));
+        memset(channel, 0, sizeof(*channel));
+
+        sv->ephemeris = Ephemerides[i % EphemerisCount];
+        sv->prn = sv->ephemeris.sat;
+        sv->caCode = caCodeSequence(sv->prn);
+        sv->navSubframesIode = -1;
+
+        channel->sv = sv;
+        channel->carrierDopplerShift_Hz = -4000.0 + (i * 537.0);
+        channel->codeDopplerShift_Hz = channel->carrierDopplerShift_Hz * (CA_CODE_FREQUENCY_HZ / CARRIER_FREQUENCY_HZ);
+        channel->codeFrequency_Hz = CA_CODE_FREQUENCY_HZ + channel->codeDopplerShift_Hz;
+        channel->gain = CHANNEL_GAIN_UNITY;
+
+        startNAVFrame(channel, time);
+        advanceChannelModulation(channel, time, (i * 1.0e-4), true);
+
+        channel->carrierRate_nco = (uint64_t)llround(channel->carrierDopplerShift_Hz * Scenario.sampleInterval_s * NCO_CARRIER_SCALE);
+        channel->codeRate_nco = (uint64_t)llround(channel->codeFrequency_Hz * Scenario.sampleInterval_s * NCO_CODE_SCALE);
+        loadChannelNCO(channel);
+    }
+}
+
+// *** BENCHMARKS ***
+
+static double benchmarkComputeParity(void* context, long iterations) {
+    unsigned long* checksum = (unsigned long*)context;
+    unsigned long previousWord = 0;
+
+    for (long i = 0; i < iterations; i++) {
+        for (unsigned long word = 0; word < 1024; word++) {
+            unsigned long data = ((word * 0x9E3779B1UL) << 6) & 0x3FFFFFC0UL;
+            computeParity(&data, &previousWord, ((word % 10) == 1));
+            *checksum += data;
+        }
+    }
+
+    return (iterations * 1024.0);
+}
+
+// Subframes from an ephemeris that has already been encoded, as in a running simulation
+static double benchmarkGenerateNAVSubframe(void* context, long iterations) {
+    Channel* channel = (Channel*)context;
+
+    for (long i = 0; i < iterations; i++) {
+        generateNAVSubframe(channel, (int)(i % SUBFRAME_COUNT));
+    }
+
+    return (double)iterations;
+}
+
+// Subframes from an ephemeris that hasn't been seen before, so the whole frame is rebuilt each time
+static double benchmarkGenerateNAVSubframeNew(void* context, long iterations) {
+    Channel* channel = (Channel*)context;
+
+    for (long i = 0; i < iterations; i++) {
+        channel->sv->navSubframesIode = -1;
+        generateNAVSubframe(channel, (int)(i % SUBFRAME_COUNT));
+    }
+
+    return (double)iterations;
+}
+
+// Look up every GPS PRN's code and read all of its chips
+static double benchmarkCACodeSequence(void* context, long iterations) {
+    unsigned long* checksum = (unsigned long*)context;
+
+    for (long i = 0; i < iterations; i++) {
+        for (int prn = 1; prn <= 32; prn++) {
+            const uint64_t* code = caCodeSequence(prn);
+
+            for (int chip = 0; chip < CA_CODE_SEQUENCE_LENGTH; chip++) {
+                *checksum += packedBit(code, chip);
+            }
+        }
+    }
+
+    return (iterations * 32.0 * CA_CODE_SEQUENCE_LENGTH);
+}
+
+typedef struct {
+    OrbitBatch* batch;
+    gtime_t time;
+    double receiverPosition_ecef[3];
+} OrbitBenchmark;
+
+// Three evaluations per SV, the most updateSatellitePositions() asks for
+static double benchmarkPropagateOrbits(void* context, long iterations) {
+    OrbitBenchmark* orbits = (OrbitBenchmark*)context;
+
+    for (long i = 0; i < iterations; i++) {
+        orbitBatchClear(orbits->batch);
+
+        for (int sv = 0; sv < EphemerisCount; sv++) {
+            for (int sample = 0; sample < 3; sample++) {
+                orbitBatchAdd(orbits->batch, sv, timeadd(orbits->time, ((i * 0.1) + sample)));
+            }
+        }
+
+        propagateOrbits(orbits->batch, orbits->receiverPosition_ecef);
+    }
+
+    return (iterations * 3.0 * EphemerisCount);
+}
+
+typedef struct {
+    Channel* channels;
+    int channelCount;
+    gtime_t epoch;
+    uint64_t sampleIndex;
+    short* iqBuffer;
+    int sampleCount;
+} SynthesisBenchmark;
+
+// One sample of every channel at a time, as synthesizeWindowReference() does
+static double benchmarkAdvanceChannelModulation(void* context, long iterations) {
+    SynthesisBenchmark* synthesis = (SynthesisBenchmark*)context;
+
+    for (long i = 0; i < iterations; i++) {
+        gtime_t time = sampleTime(synthesis->epoch, synthesis->sampleIndex++);
+
+        for (int channel = 0; channel < synthesis->channelCount; channel++) {
+            advanceChannelModulation(&synthesis->channels[channel], time, Scenario.sampleInterval_s, false);
+        }
+    }
+
+    return (double)(iterations * synthesis->channelCount);
+}
+
+static double benchmarkSynthesizeWindow(void* context, long iterations) {
+    SynthesisBenchmark* synthesis = (SynthesisBenchmark*)context;
+
+    for (long i = 0; i < iterations; i++) {
+        if (SYNTHESIS_KERNEL == SYNTHESIS_KERNEL_REFERENCE) {
+            synthesizeWindowReference(synthesis->epoch, synthesis->sampleIndex, synthesis->channels, synthesis->channelCount, synthesis->iqBuffer, synthesis->sampleCount);
+        }
+
+        else {
+            synthesizeWindow(synthesis->epoch, synthesis->sampleIndex, synthesis->channels, synthesis->channelCount, synthesis->iqBuffer, synthesis->sampleCount);
+        }
+
+        synthesis->sampleIndex += synthesis->sampleCount;
+    }
+
+    return ((double)iterations * synthesis->sampleCount);
+}
+
+static int discardOutput(void* data, int size, int sampleCount, gtime_t time) {
+    (void)data;
+    (void)size;
+    (void)sampleCount;
+    (void)time;
+
+    return 0;
+}
+
+// Run the whole simulation loop for BENCHMARK_SIMULATE_S of signal with its output thrown away (see note 3)
+static double benchmarkSimulate(void* context, long iterations) {
+    SimulationOptions* options = (SimulationOptions*)context;
+
+    silenceOutput(true);
+
+    for (long i = 0; i < iterations; i++) {
+        simulate(discardOutput, Ephemerides, EphemerisCount, options);
+    }
+
+    silenceOutput(false);
+
+    return ((double)iterations * secondsToSamples(Scenario.sampleDuration_s));
+}
+
+// *** END ***
+
+static void writeResults(const char* filename, int threadCount) {
+    FILE* file = fopen(filename, "w");
+
+    if (!file) {
+        printf("Error: Could not open results file %s\n", filename);
+        return;
+    }
+
+    fprintf(file, "{\n");
+    fprintf(file, "  \"kernel\": \"%s\",\n", KernelNames[SYNTHESIS_KERNEL]);
+    fprintf(file, "  \"mixer\": \"%s\",\n", selectChannelMixer().name);
+    fprintf(file, "  \"threads\": %i,\n", threadCount);
+    fprintf(file, "  \"sample_rate_hz\": %llu,\n", (unsigned long long)Scenario.sampleRate_Hz);
+    fprintf(file, "  \"results\": [\n");
+
+    for (int i = 0; i < ResultCount; i++) {
+        fprintf(file, "    { \"benchmark\": \"%s\", \"channels\": %i, \"window_samples\": %i, \"rate\": %.6g, \"unit\": \"%s\" }%s\n",
+            Results[i].name, Results[i].channelCount, Results[i].windowSampleCount, Results[i].rate, Results[i].unit, ((i + 1) < ResultCount) ? "," : "");
+    }
+
+    fprintf(file, "  ]\n");
+    fprintf(file, "}\n");
+
+    fclose(file);
+    printf("RESULTS WRITTEN TO: %s\n", filename);
+}
+
+int main(int argc, char* argv[]) {
+    char* ephemeridesFilename = "../tracking/brdc0010.22n";
+    char* resultsFilename = NULL;
+    int threadCount = 1;
+
+    defaultScenario(&Scenario);
+
+    for (int i = 1; i < argc; i++) {
+        if ((strcmp(argv[i], "-e") == 0) && ((i + 1) < argc)) {
+            ephemeridesFilename = argv[++i];
+        }
+
+        else if ((strcmp(argv[i], "-j") == 0) && ((i + 1) < argc)) {
+            resultsFilename = argv[++i];
+        }
+
+        else if ((strcmp(argv[i], "-t") == 0) && ((i + 1) < argc)) {
+            threadCount = atoi(argv[++i]);
+        }
+
+        else if ((strcmp(argv[i], "-v") == 0) && ((i + 1) < argc) && strchr(argv[i + 1], '=')) {
+            char* name = argv[++i];
+            char* value = strchr(name, '=');
+            *value++ = '\0';
+
+            if (setScenarioValue(&Scenario, name, value) != 0) {
+                return 1;
+            }
+        }
+
+        else {
+            printf("Usage: %s [-e ephemerides] [-j results.json] [-t threads] [-v NAME=value]...\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if ((threadCount < 1) || (finaliseScenario(&Scenario) != 0) || (loadBenchmarkEphemerides(ephemeridesFilename) != 0)) {
+        return 1;
+    }
+
+    printf("BENCHMARKING: %s KERNEL | %s MIXER | %i THREADS | %g MSPS | %i SVS\n", KernelNames[SYNTHESIS_KERNEL], selectChannelMixer().name, threadCount, Scenario.sampleFrequency_MSPS, EphemerisCount);
+
+    initNAVMessages();
+
+    gtime_t startTime = benchmarkStartTime();
+    unsigned long checksum = 0;
+
+    runBenchmark("computeParity", "words/s", 0, 0, benchmarkComputeParity, &checksum);
+    runBenchmark("caCodeSequence", "chips/s", 0, 0, benchmarkCACodeSequence, &checksum);
+
+    SV navSv;
+    Channel navChannel;
+    setupChannels(&navSv, &navChannel, 1, startTime);
+
+    runBenchmark("generateNAVSubframe", "subframes/s", 0, 0, benchmarkGenerateNAVSubframe, &navChannel);
+    runBenchmark("generateNAVSubframe (new eph)", "subframes/s", 0, 0, benchmarkGenerateNAVSubframeNew, &navChannel);
+
+    const eph_t* orbitEphemerides[BENCHMARK_MAX_SV_COUNT];
+
+    for (int i = 0; i < EphemerisCount; i++) {
+        orbitEphemerides[i] = &Ephemerides[i];
+    }
+
+    OrbitBenchmark orbits = { orbitBatchCreate(orbitEphemerides, EphemerisCount, (3 * EphemerisCount)), startTime, { 0 } };
+    double receiverPosition_llh[3] = { (53.8096268 * (PI / 180)), (-1.5553807 * (PI / 180)), 5.0 };
+    pos2ecef(receiverPosition_llh, orbits.receiverPosition_ecef);
+
+    runBenchmark("propagateOrbits", "evaluations/s", EphemerisCount, 0, benchmarkPropagateOrbits, &orbits);
+    orbitBatchDestroy(orbits.batch);
+
+    // Synthesis, swept over channel count and window size
+    for (int w = 0; w < WINDOW_COUNT; w++) {
+        for (int c = 0; c < CHANNEL_COUNT_COUNT; c++) {
+            int channelCount = BENCHMARK_CHANNEL_COUNTS[c];
+
+            Scenario.channelCount = channelCount;
+            Scenario.iqSampleWindow_s = BENCHMARK_WINDOWS_S[w];
+            finaliseScenario(&Scenario);
+
+            SV svs[channelCount];
+            Channel channels[channelCount];
+            short* iqBuffer = (short*)malloc(2 * Scenario.windowSampleCount * sizeof(short));
+
+            setupChannels(svs, channels, channelCount, startTime);
+
+            SynthesisBenchmark synthesis = { channels, channelCount, startTime, 0, iqBuffer, Scenario.windowSampleCount };
+
+            // advanceChannelModulation() doesn't depend on the window, so it's only swept over channel count
+            if (w == 0) {
+                runBenchmark("advanceChannelModulation", "channel-samples/s", channelCount, 0, benchmarkAdvanceChannelModulation, &synthesis);
+                setupChannels(svs, channels, channelCount, startTime);
+                synthesis.sampleIndex = 0;
+            }
+
+            if (SYNTHESIS_KERNEL == SYNTHESIS_KERNEL_TABLE) {
+                initCodeTables(svs, channelCount);
+            }
+
+            silenceOutput(true);
+            initSynthesis(threadCount, Scenario.windowSampleCount, NULL, NULL);
+            silenceOutput(false);
+
+            runBenchmark("synthesizeWindow", "samples/s", channelCount, Scenario.windowSampleCount, benchmarkSynthesizeWindow, &synthesis);
+
+            freeSynthesis();
+            freeCodeTables();
+            free(iqBuffer);
+        }
+    }
+
+    // The whole simulation loop, for the default channel count and each window size
+    SimulationOptions options = { .threadCount = threadCount, .outputBufferCount = 4 };
+    parseOutputFormat("int16", &options.outputFormat);
+
+    for (int w = 0; w < WINDOW_COUNT; w++) {
+        Scenario.channelCount = (DEFAULT_CHANNEL_COUNT < EphemerisCount) ? DEFAULT_CHANNEL_COUNT : EphemerisCount;
+        Scenario.iqSampleWindow_s = BENCHMARK_WINDOWS_S[w];
+        Scenario.sampleDuration_s = BENCHMARK_SIMULATE_S;
+        finaliseScenario(&Scenario);
+
+        runBenchmark("simulate", "samples/s", Scenario.channelCount, Scenario.windowSampleCount, benchmarkSimulate, &options);
+    }
+
+    // Keeps the work the benchmarks do from being optimised away
+    printf("CHECKSUM: %lu\n", checksum);
+
+    if (resultsFilename) {
+        writeResults(resultsFilename, threadCount);
+    }
+
+    return 0;
+}
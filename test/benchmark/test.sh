@@ -0,0 +1,12 @@
+#!/bin/bash
+
+# Build the benchmarks
+echo "BUILDING BENCHMARKS..."
+(cd ../../src && make benchmark) || exit 1
+
+# Run them, keeping the results for comparing against other builds
+echo "RUNNING BENCHMARKS..."
+../../build/gnss-sim-benchmark -e ../tracking/brdc0010.22n -j benchmark-results.json "$@"
+
+# Clean up temporary files
+rm -f channel-dump.txt
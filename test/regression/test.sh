@@ -0,0 +1,210 @@
+#!/bin/bash
+
+# Builds every synthesis kernel, runs a short capture from each ephemerides file with each one and checks:
+#   1. The captures are bit for bit the same as the ones recorded in golden-hashes.txt
+#   2. BLOCK gives exactly the same IQ as REFERENCE
+#   3. NCO and TABLE keep every channel's code and carrier within tolerance of REFERENCE
+#   4. NCO and TABLE give exactly the same IQ with every mixer and noise generator the CPU supports, with any
+#      number of threads, and with or without the output thread
+#   5. Captures written with io_uring ("make USE_LIBURING=1") are the same as ones written with pwrite(). Skipped if
+#      liburing isn't installed or the kernel won't allow io_uring.
+# Run "./test.sh bless" to record new golden hashes after a change that's meant to alter the output.
+
+KERNELS="REFERENCE BLOCK NCO TABLE"
+EPHEMERIDES="../tracking/brdc0010.22n ../rinex-import/ABMF00GLP_R_20240490000_01D_MN.rnx"
+DURATION_S=2
+
+# Allowed drift from REFERENCE (channel-dump.txt prints both to 6 decimal places)
+CODE_TOLERANCE_CHIPS=0.0001
+CARRIER_TOLERANCE_CYCLES=0.0001
+
+# Chips in one nav bit, where the code chip pointer wraps
+NAV_BIT_CHIPS=20460
+
+# Variants checked against each other (see check 4). Any the CPU doesn't support are skipped.
+VARIANT_KERNELS="NCO TABLE"
+MIXERS="PORTABLE SSE2 AVX2 AVX-512"
+NOISE_GENERATORS="PORTABLE AVX2"
+THREAD_COUNT=4
+
+# Gains and noise turned on so every path through the mixers and noise generators is used
+VARIANT_SCENARIO="-v SAMPLE_DURATION_S=$DURATION_S -v SIGNAL_POWER_MODEL=1 -v NOISE_CN0_DBHZ=45"
+VARIANT_EPHEMERIDES=../tracking/brdc0010.22n
+
+failures=0
+
+# Build each kernel in turn and keep a copy of its binary
+for kernel in $KERNELS; do
+    echo "BUILDING $kernel KERNEL..."
+    (cd ../../src && make -s SYNTHESIS_KERNEL=$kernel > /dev/null) || exit 1
+    cp ../../build/gnss-sim gnss-sim-$kernel
+done
+
+# Build the io_uring file writer too, if liburing is installed
+echo "BUILDING IO_URING FILE WRITER..."
+
+if (cd ../../src && make -s USE_LIBURING=1 > /dev/null 2>&1); then
+    cp ../../build/gnss-sim gnss-sim-IO_URING
+fi
+
+# Put the default build back
+(cd ../../src && make -s > /dev/null) || exit 1
+
+# Run every kernel on every ephemerides file, keeping the IQ and the channel dump
+for kernel in $KERNELS; do
+    for ephemerides in $EPHEMERIDES; do
+        name=$kernel-$(basename $ephemerides)
+
+        echo "RUNNING $name..."
+        rm -f channel-dump.txt
+        ./gnss-sim-$kernel -e $ephemerides -o $name.bin -v SAMPLE_DURATION_S=$DURATION_S > $name.log 2>&1 || failures=$((failures + 1))
+        mv channel-dump.txt $name.dump
+    done
+done
+
+# Record or check the golden hashes
+if [ "$1" == "bless" ]; then
+    echo ""
+    echo "RECORDING GOLDEN HASHES..."
+    md5sum *.bin > golden-hashes.txt
+else
+    echo ""
+    echo "CHECKING GOLDEN HASHES..."
+    md5sum -c golden-hashes.txt || failures=$((failures + 1))
+fi
+
+# Check the optimised kernels against the reference one
+echo ""
+echo "CHECKING KERNELS AGAINST REFERENCE..."
+
+for ephemerides in $EPHEMERIDES; do
+    file=$(basename $ephemerides)
+
+    if cmp -s REFERENCE-$file.bin BLOCK-$file.bin; then
+        echo "BLOCK-$file: OK"
+    else
+        echo "BLOCK-$file: FAILED (IQ differs from REFERENCE)"
+        failures=$((failures + 1))
+    fi
+
+    # The dumps line up row for row. Compare PRN, then code position (nav bit and chip) and carrier phase, allowing for wrapping.
+    for kernel in NCO TABLE; do
+        paste REFERENCE-$file.dump $kernel-$file.dump | awk -F'\t' \
+            -v codeTolerance=$CODE_TOLERANCE_CHIPS -v carrierTolerance=$CARRIER_TOLERANCE_CYCLES -v navBitChips=$NAV_BIT_CHIPS '
+            NR > 1 {
+                if (($2 + 0) != ($16 + 0)) {
+                    mismatches++
+                    next
+                }
+
+                codeError = (($13 - $27) * navBitChips) + ($12 - $26)
+                if (codeError < 0) codeError = -codeError
+                if (codeError > maxCodeError) maxCodeError = codeError
+
+                carrierError = $14 - $28
+                if (carrierError < 0) carrierError = -carrierError
+                if (carrierError > 0.5) carrierError = 1 - carrierError
+                if (carrierError > maxCarrierError) maxCarrierError = carrierError
+
+                rows++
+            }
+
+            END {
+                failed = ((rows == 0) || (mismatches > 0) || (maxCodeError > codeTolerance) || (maxCarrierError > carrierTolerance))
+
+                printf "%s: %s (%d ROWS | %d PRN MISMATCHES | MAX CODE ERROR: %g CHIPS | MAX CARRIER ERROR: %g CYCLES)\n",
+                    name, (failed ? "FAILED" : "OK"), rows, mismatches, maxCodeError, maxCarrierError
+
+                exit failed
+            }' name=$kernel-$file || failures=$((failures + 1))
+    done
+done
+
+# Run one variant and check its IQ is the same as the baseline's. Arguments are the name to report and gnss-sim's extra flags.
+checkVariant() {
+    name=$1
+    shift
+
+    ./gnss-sim-$kernel -e $VARIANT_EPHEMERIDES -o $kernel-$name.bin $VARIANT_SCENARIO "$@" > $kernel-$name.log 2>&1
+    result=$?
+
+    if grep -q "doesn't support" $kernel-$name.log; then
+        echo "$kernel-$name: SKIPPED (NOT SUPPORTED BY THIS CPU)"
+    elif [ $result -ne 0 ]; then
+        echo "$kernel-$name: FAILED (EXIT CODE $result)"
+        failures=$((failures + 1))
+    elif cmp -s $kernel-BASELINE.bin $kernel-$name.bin; then
+        echo "$kernel-$name: OK"
+    else
+        echo "$kernel-$name: FAILED (IQ differs from BASELINE)"
+        failures=$((failures + 1))
+    fi
+}
+
+# The baseline is the portable code on one thread, with the output thread
+echo ""
+echo "CHECKING VARIANTS AGAINST EACH OTHER..."
+
+for kernel in $VARIANT_KERNELS; do
+    ./gnss-sim-$kernel -e $VARIANT_EPHEMERIDES -o $kernel-BASELINE.bin $VARIANT_SCENARIO -x PORTABLE -n PORTABLE -t 1 > $kernel-BASELINE.log 2>&1 || failures=$((failures + 1))
+
+    for mixer in $MIXERS; do
+        checkVariant MIXER-$mixer -x $mixer -n PORTABLE -t 1
+    done
+
+    for generator in $NOISE_GENERATORS; do
+        checkVariant NOISE-$generator -x PORTABLE -n $generator -t 1
+    done
+
+    checkVariant THREADS-$THREAD_COUNT -x PORTABLE -n PORTABLE -t $THREAD_COUNT
+    checkVariant UNPIPELINED -x PORTABLE -n PORTABLE -t 1 -b 0
+
+    # And everything at once, as gnss-sim runs by default on this CPU
+    checkVariant WIDEST-THREADS-$THREAD_COUNT-UNPIPELINED -t $THREAD_COUNT -b 0
+done
+
+# The io_uring build uses the default (NCO) kernel, so its captures should match the NCO ones
+echo ""
+echo "CHECKING IO_URING FILE WRITER AGAINST PWRITE..."
+
+for ephemerides in $EPHEMERIDES; do
+    file=$(basename $ephemerides)
+
+    for mode in BUFFERED DIRECT; do
+        name=IO_URING-$mode-$file
+
+        if [ ! -f gnss-sim-IO_URING ]; then
+            echo "$name: SKIPPED (LIBURING NOT INSTALLED)"
+            continue
+        fi
+
+        flags=""
+        [ $mode == DIRECT ] && flags="-d"
+
+        ./gnss-sim-IO_URING -e $ephemerides -o $name.bin -v SAMPLE_DURATION_S=$DURATION_S $flags > $name.log 2>&1
+        result=$?
+
+        if ! grep -q "FILE WRITER: IO_URING" $name.log; then
+            echo "$name: SKIPPED (IO_URING NOT ALLOWED BY THE KERNEL)"
+        elif [ $result -ne 0 ]; then
+            echo "$name: FAILED (EXIT CODE $result)"
+            failures=$((failures + 1))
+        elif cmp -s NCO-$file.bin $name.bin; then
+            echo "$name: OK"
+        else
+            echo "$name: FAILED (CAPTURE DIFFERS FROM PWRITE)"
+            failures=$((failures + 1))
+        fi
+    done
+done
+
+# Clean up temporary files
+rm -f gnss-sim-* *.bin *.bin.index *.dump *.log channel-dump.txt
+
+echo ""
+if [ $failures -gt 0 ]; then
+    echo "REGRESSION FAILED ($failures CHECKS)"
+    exit 1
+fi
+
+echo "REGRESSION PASSED"
@@ -0,0 +1,173 @@
+#include <stdio.h>
+#include <stdint.h>
+
+#define SEQUENCE_LENGTH (1023)
+#define REGISTER_LENGTH (10)
+#define WORD_COUNT ((SEQUENCE_LENGTH + 63) / 64)
+#define MAX_PRN (202)
+
+#define WIDTH 4
+
+// PRNs are numbered consecutively from firstPrn, each one's G2 code delayed by the next entry of delays (in chips)
+typedef struct {
+    const char* name;
+    int firstPrn;
+    int count;
+    short delays[63];
+} CodeRange;
+
+static const CodeRange ranges[] = {
+    // (Ref: IS-GPS-200N, Table 3-Ia. Code Phase Assignments and Table 3-Ib. Expanded Code Phase Assignments)
+    { "GPS", 1, 63, {
+          5,    6,    7,    8,   17,   18,  139,  140,  141,  251,
+        252,  254,  255,  256,  257,  258,  469,  470,  471,  472,
+        473,  474,  509,  512,  513,  514,  515,  516,  859,  860,
+        861,  862,  863,  950,  947,  948,  950,   67,  103,   91,
+         19,  679,  225,  625,  946,  638,  161, 1001,  554,  280,
+        710,  709,  775,  864,  558,  220,  397,   55,  898,  759,
+        367,  299, 1018
+    } },
+
+    // (Ref: RTCA DO-229, Appendix A. SBAS PRN code assignments)
+    { "SBAS", 120, 39, {
+        145,  175,   52,   21,  237,  235,  886,  657,  634,  762,
+        355, 1012,  176,  603,  130,  359,  595,   68,  386,  797,
+        456,  499,  883,  307,  127,  211,  121,  118,  163,  628,
+        853,  484,  289,  811,  202, 1021,  463,  568,  904
+    } },
+
+    // (Ref: IS-QZSS-PNT, L1C/A PRN code assignments)
+    { "QZSS", 193, 10, {
+        339,  208,  711,  189,  263,  537,  663,  942,  173,  900
+    } }
+};
+
+// Run a 10-stage LFSR for a whole code period, starting from all ones.
+// taps holds the register stages (numbered from 1) XORed together to form the feedback. The output is stage 10.
+void generateSequence(char* sequence, const int* taps, int tapCount) {
+    char reg[REGISTER_LENGTH];
+
+    for (int i = 0; i < REGISTER_LENGTH; i++) {
+        reg[i] = 1;
+    }
+
+    for (int i = 0; i < SEQUENCE_LENGTH; i++) {
+        char feedback = 0;
+
+        sequence[i] = reg[REGISTER_LENGTH - 1];
+
+        for (int tap = 0; tap < tapCount; tap++) {
+            feedback ^= reg[taps[tap] - 1];
+        }
+
+        for (int j = (REGISTER_LENGTH - 1); j > 0; j--) {
+            reg[j] = reg[j - 1];
+        }
+
+        reg[0] = feedback;
+    }
+}
+
+// Write one PRN's code as packed chips, chip i in bit (i % 64) of word (i / 64). The same layout as packedBit() reads.
+void generateTable(FILE* file, const char* g1, const char* g2, const CodeRange* range, int index) {
+    uint64_t packed[WORD_COUNT] = { 0 };
+    int delay = range->delays[index];
+
+    // G1 XOR G2 delayed by "delay" chips (Ref: IS-GPS-200N, 3.3.2.3 C/A-Code Generation)
+    for (int i = 0; i < SEQUENCE_LENGTH; i++) {
+        uint64_t chip = (g1[i] ^ g2[(i + SEQUENCE_LENGTH - delay) % SEQUENCE_LENGTH]);
+        packed[i >> 6] |= (chip << (i & 63));
+    }
+
+    fprintf(file, "\t// %s PRN %i\n\t{\n", range->name, (range->firstPrn + index));
+
+    for (int word = 0; word < WORD_COUNT; word++) {
+        // Insert tab at begining of line
+        if ((word % WIDTH) == 0) {
+            fprintf(file, "\t\t");
+        }
+
+        fprintf(file, "0x%016llXULL, ", (unsigned long long)packed[word]);
+
+        // Insert newline at end of line
+        if (((word + 1) % WIDTH) == 0) {
+            fprintf(file, "\n");
+        }
+    }
+
+    fprintf(file, "\t},\n");
+}
+
+int main() {
+    FILE* file;
+
+    // G1 = 1 + X^3 + X^10, G2 = 1 + X^2 + X^3 + X^6 + X^8 + X^9 + X^10 (Ref: IS-GPS-200N, 3.3.2.3 C/A-Code Generation)
+    const int g1Taps[] = { 3, 10 };
+    const int g2Taps[] = { 2, 3, 6, 8, 9, 10 };
+
+    char g1[SEQUENCE_LENGTH];
+    char g2[SEQUENCE_LENGTH];
+
+    generateSequence(g1, g1Taps, 2);
+    generateSequence(g2, g2Taps, 6);
+
+    short rows[MAX_PRN + 1];
+    int codeCount = 0;
+
+    for (int prn = 0; prn <= MAX_PRN; prn++) {
+        rows[prn] = -1;
+    }
+
+    for (size_t range = 0; range < (sizeof(ranges) / sizeof(ranges[0])); range++) {
+        for (int i = 0; i < ranges[range].count; i++) {
+            rows[ranges[range].firstPrn + i] = codeCount++;
+        }
+    }
+
+    file = fopen("ca-code-tables.h", "w");
+
+    if (file == NULL) {
+        printf("ERROR OPENING FILE\n");
+        return 1;
+    }
+
+    fprintf(file, "#ifndef CA_CODE_TABLES_H\n");
+    fprintf(file, "#define CA_CODE_TABLES_H\n\n");
+    fprintf(file, "// Generated by tools/ca-code-tables-generator.c. Don't edit by hand!\n\n");
+    fprintf(file, "#include <stdint.h>\n\n");
+    fprintf(file, "#define CA_CODE_TABLE_COUNT (%i)\n", codeCount);
+    fprintf(file, "#define CA_CODE_TABLE_MAX_PRN (%i)\n\n", MAX_PRN);
+
+    // Row of caCodeTables for each PRN (-1 if there isn't one)
+    fprintf(file, "static const short caCodeTableRows[%i] = {\n", (MAX_PRN + 1));
+
+    for (int prn = 0; prn <= MAX_PRN; prn++) {
+        if ((prn % 16) == 0) {
+            fprintf(file, "\t");
+        }
+
+        fprintf(file, "%d, ", rows[prn]);
+
+        if ((((prn + 1) % 16) == 0) || (prn == MAX_PRN)) {
+            fprintf(file, "\n");
+        }
+    }
+
+    fprintf(file, "};\n\n");
+
+    fprintf(file, "static const uint64_t caCodeTables[%i][%i] = {\n", codeCount, WORD_COUNT);
+
+    for (size_t range = 0; range < (sizeof(ranges) / sizeof(ranges[0])); range++) {
+        for (int i = 0; i < ranges[range].count; i++) {
+            generateTable(file, g1, g2, &ranges[range], i);
+        }
+    }
+
+    fprintf(file, "};\n\n");
+    fprintf(file, "#endif\n");
+
+    fclose(file);
+    printf("C/A CODE TABLES GENERATED SUCCESSFULLY!\n");
+
+    return 0;
+}
@@ -1,84 +1,108 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <math.h>
 
-#define INDEX_MULTIPLIER 12
-#define TABLE_SIZE (1 << INDEX_MULTIPLIER)
-#define AMPLITUDE (250.0)
-#define RESOLUTION (360.0 / TABLE_SIZE)
-
-#define WIDTH 16
-
-enum {
-    SIN,
-    COS
-};
-
-void generateTable(FILE* file, int function) {
-    switch (function) {
-        case SIN:
-            fprintf(file, "const int sinTable[%i] = {\n", TABLE_SIZE);
-            break;
-        
-        case COS:
-            fprintf(file, "const int cosTable[%i] = {\n", TABLE_SIZE);
-            break;
-    }
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// Defaults, used when the settings aren't given on the command line (see usage below)
+#define DEFAULT_INDEX_BITS 12
+#define DEFAULT_AMPLITUDE 250
+#define DEFAULT_INTERPOLATION 0
+
+#define WIDTH 8
 
-    for (int i = 0; i < TABLE_SIZE; i++) {
-        // Init variables
-        int value;
-        double angle;
+// Writes trig-tables.h (settings and declarations) and trig-tables.c (the table) to the current directory.
+// Usage: trig-tables-generator [index bits] [amplitude] [interpolation (0 or 1)]
+// NOTES:
+// 1. The table holds cos (low 16 bits) and sin (high 16 bits) of each of 2^(index bits) phases, so a sample's I and Q
+//    values are one 32-bit load. src/makefile passes its TRIG_TABLE_ settings in, e.g. "make TRIG_TABLE_INDEX_BITS=14".
+// 2. One extra entry (the same as the first) follows the last, so interpolating kernels can always read the next one.
+// 3. More index bits push the spurs from phase truncation down (about 6 dB per bit) at the cost of cache footprint.
+//    Interpolation gets much the same improvement from a small table, for a second load and a multiply per sample.
 
+void generateTable(FILE* file, int indexBits, int amplitude) {
+    int tableSize = (1 << indexBits);
+    double resolution = (360.0 / tableSize);
+
+    fprintf(file, "#include <stdint.h>\n\n");
+    fprintf(file, "#include \"../include/trig-tables.h\"\n\n");
+    fprintf(file, "const int32_t trigTable[TRIG_TABLE_SIZE + 1] __attribute__((aligned(64))) = {\n");
+
+    for (int i = 0; i <= tableSize; i++) {
         // Insert tab at begining of line
         if ((i % WIDTH) == 0) {
             fprintf(file, "\t");
         }
 
         // Generate value
-        angle = (i * RESOLUTION) * M_PI / 180.0;
-
-        switch (function) {
-            case SIN:
-                value = (int)(AMPLITUDE * sin(angle));
-                break;
-            
-            case COS:
-                value = (int)(AMPLITUDE * cos(angle));
-                break;
-        }
+        double angle = ((i % tableSize) * resolution) * M_PI / 180.0;
+        int cosine = (int)(amplitude * cos(angle));
+        int sine = (int)(amplitude * sin(angle));
 
         // Write value
-        fprintf(file, "%d, ", value);
+        fprintf(file, "0x%08X, ", ((unsigned)(sine & 0xFFFF) << 16) | (unsigned)(cosine & 0xFFFF));
 
         // Insert newline at end of line
-        if (((i + 1) % WIDTH) == 0) {
+        if ((((i + 1) % WIDTH) == 0) || (i == tableSize)) {
             fprintf(file, "\n");
         }
     }
 
-    fprintf(file, "};\n\n");
+    fprintf(file, "};\n");
 }
 
-int main() {
-    FILE* file;
+void generateHeader(FILE* file, int indexBits, int amplitude, int interpolation) {
+    fprintf(file, "#ifndef TRIG_TABLES_H\n");
+    fprintf(file, "#define TRIG_TABLES_H\n\n");
+    fprintf(file, "// Generated by tools/trig-tables-generator.c. Don't edit by hand!\n\n");
+    fprintf(file, "#include <stdint.h>\n\n");
+    fprintf(file, "#define TRIG_TABLE_INDEX_BITS       (%i)\n", indexBits);
+    fprintf(file, "#define TRIG_TABLE_SIZE             (1 << TRIG_TABLE_INDEX_BITS)\n");
+    fprintf(file, "#define TRIG_TABLE_AMPLITUDE        (%i)\n", amplitude);
+    fprintf(file, "#define TRIG_TABLE_INTERPOLATION    (%i)\n\n", interpolation);
+    fprintf(file, "// Unpack the cosine and sine from a table entry\n");
+    fprintf(file, "#define TRIG_TABLE_COS(entry)       ((int32_t)(int16_t)((entry) & 0xFFFF))\n");
+    fprintf(file, "#define TRIG_TABLE_SIN(entry)       ((int32_t)(entry) >> 16)\n\n");
+    fprintf(file, "extern const int32_t trigTable[TRIG_TABLE_SIZE + 1];\n\n");
+    fprintf(file, "#endif\n");
+}
 
-    file = fopen("trig-tables.h", "w");
+int main(int argc, char** argv) {
+    int indexBits = (argc > 1) ? atoi(argv[1]) : DEFAULT_INDEX_BITS;
+    int amplitude = (argc > 2) ? atoi(argv[2]) : DEFAULT_AMPLITUDE;
+    int interpolation = (argc > 3) ? atoi(argv[3]) : DEFAULT_INTERPOLATION;
 
-    if (file == NULL) {
-        printf("ERROR OPENING FILE\n");
+    if ((indexBits < 4) || (indexBits > 20)) {
+        printf("ERROR: INDEX BITS MUST BE BETWEEN 4 AND 20\n");
         return 1;
     }
 
-    fprintf(file, "#ifndef TRIG_TABLES_H\n");
-    fprintf(file, "#define TRIG_TABLES_H\n\n");
+    if ((amplitude < 1) || (amplitude > 32767)) {
+        printf("ERROR: AMPLITUDE MUST BE BETWEEN 1 AND 32767\n");
+        return 1;
+    }
 
-    generateTable(file, SIN);
-    generateTable(file, COS);
+    if ((interpolation != 0) && (interpolation != 1)) {
+        printf("ERROR: INTERPOLATION MUST BE 0 OR 1\n");
+        return 1;
+    }
 
-    fprintf(file, "#endif\n");
+    FILE* header = fopen("trig-tables.h", "w");
+    FILE* table = fopen("trig-tables.c", "w");
 
-    fclose(file);
-    printf("TRIG TABLES GENERATED SUCCESSFULLY!\n");
+    if ((header == NULL) || (table == NULL)) {
+        printf("ERROR OPENING FILE\n");
+        return 1;
+    }
+
+    generateHeader(header, indexBits, amplitude, interpolation);
+    generateTable(table, indexBits, amplitude);
+
+    fclose(header);
+    fclose(table);
+    printf("TRIG TABLES GENERATED SUCCESSFULLY! (%i ENTRIES | AMPLITUDE %i | INTERPOLATION %s)\n", (1 << indexBits), amplitude, interpolation ? "ON" : "OFF");
 
     return 0;
-}
\ No newline at end of file
+}